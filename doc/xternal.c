@@ -4422,6 +4422,19 @@
  * If this callback is not implemented, there is currently no particular performance impact.
  * In a future version, not implementing this callback would mean that Hessians are not available for NLP solvers, in which case they may have to work with approximations.
  *
+ * @subsection EXPREVALBATCH
+ *
+ * This callback is called when an expression is evaluated at a block of points, see SCIPevalExprBatch().
+ * It receives the values of the children at all points in structure-of-arrays layout and shall store the values
+ * of the expression at all points.
+ * Different to \ref EXPREVAL, children may have value `SCIP_INVALID` at some points, in which case the value of the
+ * expression at these points shall be set to `SCIP_INVALID`, too.
+ * Implementations should be written as tight loops over the points, so that they can be vectorized by the compiler.
+ * For example, for exponentials:
+ * @refsnippet{src/scip/expr_exp.c,SnippetExprEvalBatchExp}
+ *
+ * If this callback is not implemented, batched evaluation calls \ref EXPREVAL for each point.
+ *
  * @subsection EXPRINTEVAL
  *
  * This callback is called when bounds on an expression need to be computed.
@@ -849,6 +849,28 @@ SCIP_RETCODE SCIPlpiGetBInvRow(
                                               *   (-1: if we do not store sparsity information) */
    );
 
+/** get several rows of inverse basis matrix B^-1 at once
+ *
+ *  The k-th requested row is stored in coefs[k * nrows, ..., (k+1) * nrows - 1] and, if requested, its non-zero
+ *  indices in inds[k * nrows, ...]. LP solvers that can compute several rows with one pass over the factorization may
+ *  implement this more efficiently than by calling SCIPlpiGetBInvRow() for each row; currently, all LP interfaces get
+ *  the rows one by one.
+ *
+ *  @note The LP interface defines slack variables to have coefficient +1. This means that if, internally, the LP solver
+ *        uses a -1 coefficient, then rows associated with slacks variables whose coefficient is -1, should be negated;
+ *        see also the explanation in lpi.h.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPlpiGetBInvRows(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   int                   nrs,                /**< number of rows to get */
+   const int*            rs,                 /**< row numbers */
+   SCIP_Real*            coefs,              /**< array of size nrs * nrows to store the coefficients of the rows */
+   int*                  inds,               /**< array of size nrs * nrows to store the non-zero indices, or NULL */
+   int*                  ninds               /**< array of size nrs to store the numbers of non-zero indices, or NULL
+                                              *   (-1: if we do not store sparsity information) */
+   );
+
 /** get column of inverse basis matrix B^-1
  *
  *  @note The LP interface defines slack variables to have coefficient +1. This means that if, internally, the LP solver
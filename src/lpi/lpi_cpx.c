@@ -3750,6 +3750,44 @@ SCIP_RETCODE SCIPlpiGetBInvRow(
    return SCIP_OKAY;
 }
 
+/** get several rows of inverse basis matrix B^-1 at once
+ *
+ *  @note The LP interface defines slack variables to have coefficient +1. This means that if, internally, the LP solver
+ *        uses a -1 coefficient, then rows associated with slacks variables whose coefficient is -1, should be negated;
+ *        see also the explanation in lpi.h.
+ */
+SCIP_RETCODE SCIPlpiGetBInvRows(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   int                   nrs,                /**< number of rows to get */
+   const int*            rs,                 /**< row numbers */
+   SCIP_Real*            coefs,              /**< array of size nrs * nrows to store the coefficients of the rows */
+   int*                  inds,               /**< array of size nrs * nrows to store the non-zero indices, or NULL */
+   int*                  ninds               /**< array of size nrs to store the numbers of non-zero indices, or NULL
+                                              *   (-1: if we do not store sparsity information) */
+   )
+{
+   int nrows;
+   int k;
+
+   SCIPdebugMessage("calling SCIPlpiGetBInvRows()\n");
+
+   assert(lpi != NULL);
+   assert(nrs >= 0);
+   assert(rs != NULL || nrs == 0);
+   assert(coefs != NULL);
+
+   SCIP_CALL( SCIPlpiGetNRows(lpi, &nrows) );
+
+   /* this LP solver offers no batched access, so get the rows one by one */
+   for( k = 0; k < nrs; ++k )
+   {
+      SCIP_CALL( SCIPlpiGetBInvRow(lpi, rs[k], &coefs[(size_t)k * nrows], inds != NULL ? &inds[(size_t)k * nrows] : NULL,
+            ninds != NULL ? &ninds[k] : NULL) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** get column of inverse basis matrix B^-1
  *
  *  @note The LP interface defines slack variables to have coefficient +1. This means that if, internally, the LP solver
@@ -79,6 +79,7 @@
 #include "scip/tree.h"
 #include "scip/var.h"
 #include "scip/visual.h"
+#include "tpi/tpi.h"
 
 #define BOUNDSWITCH                0.51 /**< threshold for bound switching - see cuts.c */
 #define POSTPROCESS               FALSE /**< apply postprocessing to the cut - see cuts.c */
@@ -86,6 +87,40 @@
 #define ALLOWLOCAL                FALSE /**< allow to generate local cuts - see cuts. */
 #define MINFRAC                   0.05  /**< minimal fractionality of floor(rhs) - see cuts.c */
 #define MAXFRAC                   0.999 /**< maximal fractionality of floor(rhs) - see cuts.c */
+#define ALTPROOF_MAXDELTAS            8 /**< maximal number of scaling factors tried for alternative proofs by scaled MIR */
+
+/** data of a dual proof that is shared by the jobs constructing alternative proofs
+ *
+ *  The jobs only work on these copies of the proof and the bounds of its variables, such that they do not access any
+ *  SCIP data and can run on TPI workers.
+ */
+struct AltProofData
+{
+   SCIP_Real*            vals;               /**< coefficients of the proof */
+   SCIP_Real*            glbs;               /**< global lower bounds of the proof variables */
+   SCIP_Real*            gubs;               /**< global upper bounds of the proof variables */
+   SCIP_Real*            lbs;                /**< local lower bounds of the proof variables */
+   SCIP_Real*            ubs;                /**< local upper bounds of the proof variables */
+   SCIP_Bool*            integral;           /**< is the proof variable of integral type? */
+   SCIP_Real             rhs;                /**< right-hand side of the proof */
+   SCIP_Real             infinity;           /**< value for infinity */
+   SCIP_Real             epsilon;            /**< absolute values smaller than this are considered zero */
+   int                   nnz;                /**< number of variables in the proof */
+};
+typedef struct AltProofData ALTPROOFDATA;
+
+/** job constructing an alternative proof by a mixed-integer rounding of the dual proof divided by a scaling factor */
+struct AltProofJob
+{
+   ALTPROOFDATA*         data;               /**< dual proof */
+   SCIP_Real*            cutvals;            /**< array to store the coefficients of the alternative proof on the proof variables */
+   SCIP_Real             delta;              /**< scaling factor */
+   SCIP_Real             cutrhs;             /**< right-hand side of the alternative proof */
+   SCIP_Real             efficacy;           /**< violation of the alternative proof w.r.t. the local bounds divided by its norm */
+   int                   cutnnz;             /**< number of non-zero coefficients of the alternative proof */
+   SCIP_Bool             success;            /**< was an alternative proof constructed? */
+};
+typedef struct AltProofJob ALTPROOFJOB;
 
 
 /*
@@ -1278,6 +1313,366 @@ void tightenCoefficients(
 #endif
 }
 
+/** returns the global bound of a proof variable that is used to complement it in a mixed-integer rounding, i.e., the
+ *  finite global bound closer to the local bound attaining the minimal activity of the proof
+ */
+static
+SCIP_Real altProofGetComplBound(
+   ALTPROOFDATA*         data,               /**< dual proof */
+   int                   pos,                /**< position of the variable in the proof */
+   SCIP_Bool*            uselb               /**< pointer to store whether the lower bound is used */
+   )
+{
+   SCIP_Real locbound;
+
+   locbound = (data->vals[pos] > 0.0 ? data->lbs[pos] : data->ubs[pos]);
+
+   *uselb = (data->gubs[pos] >= data->infinity
+      || (data->glbs[pos] > -data->infinity && locbound - data->glbs[pos] <= data->gubs[pos] - locbound));
+
+   return (*uselb ? data->glbs[pos] : data->gubs[pos]);
+}
+
+/** job function computing the mixed-integer rounding of the dual proof divided by the scaling factor of the job
+ *
+ *  The proof variables are complemented by their global bounds, such that the alternative proof is valid wherever the
+ *  dual proof is valid. Continuous variables with nonnegative coefficients after complementation are relaxed.
+ */
+static
+SCIP_RETCODE altProofJob(
+   void*                 args                /**< alternative proof job */
+   )
+{
+   ALTPROOFJOB* job = (ALTPROOFJOB*)args;
+   ALTPROOFDATA* data;
+   SCIP_Real downrhs;
+   SCIP_Real minact;
+   SCIP_Real norm;
+   SCIP_Real rhs;
+   SCIP_Real f0;
+   int i;
+
+   assert(job != NULL);
+
+   data = job->data;
+   job->success = FALSE;
+   job->cutnnz = 0;
+
+   /* compute the right-hand side of the complemented and scaled proof */
+   rhs = data->rhs;
+   for( i = 0; i < data->nnz; ++i )
+   {
+      SCIP_Bool uselb;
+      SCIP_Real bound;
+
+      bound = altProofGetComplBound(data, i, &uselb);
+
+      if( REALABS(bound) >= data->infinity )
+         return SCIP_OKAY;
+
+      rhs -= data->vals[i] * bound;
+   }
+   rhs /= job->delta;
+
+   downrhs = floor(rhs + data->epsilon);
+   f0 = rhs - downrhs;
+
+   if( f0 < MINFRAC || f0 > MAXFRAC )
+      return SCIP_OKAY;
+
+   /* compute the rounded coefficients and transform them back to the original variables */
+   job->cutrhs = downrhs;
+   minact = 0.0;
+   norm = 0.0;
+   for( i = 0; i < data->nnz; ++i )
+   {
+      SCIP_Bool uselb;
+      SCIP_Real bound;
+      SCIP_Real coef;
+      SCIP_Real val;
+
+      bound = altProofGetComplBound(data, i, &uselb);
+      val = (uselb ? data->vals[i] : -data->vals[i]) / job->delta;
+
+      if( data->integral[i] )
+      {
+         SCIP_Real downval = floor(val + data->epsilon);
+
+         coef = downval + MAX(0.0, val - downval - f0) / (1.0 - f0);
+      }
+      else
+         coef = (val < 0.0 ? val / (1.0 - f0) : 0.0);
+
+      if( !uselb )
+         coef = -coef;
+
+      if( REALABS(coef) < data->epsilon )
+      {
+         job->cutvals[i] = 0.0;
+         continue;
+      }
+
+      job->cutvals[i] = coef;
+      job->cutrhs += coef * bound;
+      ++job->cutnnz;
+
+      if( coef > 0.0 ? data->lbs[i] <= -data->infinity : data->ubs[i] >= data->infinity )
+         return SCIP_OKAY;
+
+      minact += coef * (coef > 0.0 ? data->lbs[i] : data->ubs[i]);
+      norm += coef * coef;
+   }
+
+   if( job->cutnnz == 0 )
+      return SCIP_OKAY;
+
+   job->efficacy = (minact - job->cutrhs) / sqrt(norm);
+   job->success = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** checks whether the alternative proofs of two jobs are equal */
+static
+SCIP_Bool altProofsAreEqual(
+   ALTPROOFJOB*          job1,               /**< first alternative proof job */
+   ALTPROOFJOB*          job2,               /**< second alternative proof job */
+   SCIP_Real             epsilon             /**< absolute differences smaller than this are considered zero */
+   )
+{
+   int i;
+
+   if( job1->cutnnz != job2->cutnnz || REALABS(job1->cutrhs - job2->cutrhs) > epsilon )
+      return FALSE;
+
+   for( i = 0; i < job1->data->nnz; ++i )
+   {
+      if( REALABS(job1->cutvals[i] - job2->cutvals[i]) > epsilon )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** constructs alternative proofs by mixed-integer roundings of the dual proof divided by different scaling factors
+ *
+ *  The scaling factors are the distinct absolute coefficients of the integral variables in the proof. The roundings
+ *  are computed on at most conflict/altproofthreads threads, and the at most maxnproofs strongest ones that are more
+ *  efficacious per nonzero than the dual proof are added as alternative proofs.
+ */
+static
+SCIP_RETCODE addScaledMirProofs(
+   SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_PROB*            transprob,          /**< transformed problem */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_AGGRROW*         proofrow,           /**< proof rows data */
+   int                   validdepth,         /**< depth where the proof is valid */
+   SCIP_Real*            curvarlbs,          /**< current lower bounds of active problem variables */
+   SCIP_Real*            curvarubs,          /**< current upper bounds of active problem variables */
+   SCIP_CONFTYPE         conflicttype,       /**< type of the conflict */
+   int                   maxnproofs          /**< maximal number of alternative proofs to add */
+   )
+{
+   ALTPROOFDATA data;
+   ALTPROOFJOB* jobs;
+   SCIP_VAR** vars;
+   SCIP_Real* deltas;
+   SCIP_Real* cutvals;
+   SCIP_Real* efficacies;
+   SCIP_Real* proofvals;
+   void** jobargs;
+   int* proofinds;
+   int* inds;
+   int* order;
+   SCIP_Real proofminact;
+   SCIP_Real proofnorm;
+   SCIP_Real proofefficacy;
+   SCIP_RETCODE retcode;
+   int ndeltas;
+   int ncands;
+   int nadded;
+   int nnz;
+   int i;
+   int j;
+
+   assert(maxnproofs >= 1);
+
+   vars = SCIPprobGetVars(transprob);
+   inds = SCIPaggrRowGetInds(proofrow);
+   nnz = SCIPaggrRowGetNNz(proofrow);
+
+   if( nnz == 0 )
+      return SCIP_OKAY;
+
+   /* copy the proof and the bounds of its variables */
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &data.vals, nnz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &data.glbs, nnz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &data.gubs, nnz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &data.lbs, nnz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &data.ubs, nnz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &data.integral, nnz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &deltas, ALTPROOF_MAXDELTAS) );
+
+   data.rhs = SCIPaggrRowGetRhs(proofrow);
+   data.infinity = SCIPsetInfinity(set);
+   data.epsilon = SCIPsetEpsilon(set);
+   data.nnz = nnz;
+
+   proofminact = 0.0;
+   proofnorm = 0.0;
+   ndeltas = 0;
+
+   for( i = 0; i < nnz; ++i )
+   {
+      SCIP_VAR* var = vars[inds[i]];
+
+      data.vals[i] = SCIPaggrRowGetProbvarValue(proofrow, inds[i]);
+      data.glbs[i] = SCIPvarGetLbGlobal(var);
+      data.gubs[i] = SCIPvarGetUbGlobal(var);
+      data.lbs[i] = curvarlbs[inds[i]];
+      data.ubs[i] = curvarubs[inds[i]];
+      data.integral[i] = SCIPvarIsIntegral(var);
+
+      proofminact += data.vals[i] * (data.vals[i] > 0.0 ? data.lbs[i] : data.ubs[i]);
+      proofnorm += SQR(data.vals[i]);
+
+      /* collect the distinct absolute coefficients of integral variables as scaling factors */
+      if( data.integral[i] && ndeltas < ALTPROOF_MAXDELTAS && !SCIPsetIsZero(set, data.vals[i]) )
+      {
+         for( j = 0; j < ndeltas; ++j )
+         {
+            if( SCIPsetIsEQ(set, deltas[j], REALABS(data.vals[i])) )
+               break;
+         }
+
+         if( j == ndeltas )
+            deltas[ndeltas++] = REALABS(data.vals[i]);
+      }
+   }
+
+   proofefficacy = (proofminact - data.rhs) / MAX(1e-6, sqrt(proofnorm));
+
+   if( ndeltas == 0 )
+      goto TERMINATE;
+
+   /* compute the roundings for all scaling factors */
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &jobs, ndeltas) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &jobargs, ndeltas) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &cutvals, ndeltas * nnz) );
+
+   for( i = 0; i < ndeltas; ++i )
+   {
+      jobs[i].data = &data;
+      jobs[i].cutvals = &cutvals[i * nnz];
+      jobs[i].delta = deltas[i];
+      jobs[i].success = FALSE;
+      jobargs[i] = (void*)&jobs[i];
+   }
+
+   if( set->conf_altproofthreads > 1 && ndeltas > 1 && SCIPtpiIsAvailable() )
+      retcode = SCIPtpiExecuteJobs(altProofJob, jobargs, ndeltas, set->conf_altproofthreads);
+   else
+   {
+      retcode = SCIP_OKAY;
+      for( i = 0; i < ndeltas && retcode == SCIP_OKAY; ++i )
+         retcode = altProofJob(jobargs[i]);
+   }
+   SCIP_CALL( retcode );
+
+   /* sort the alternative proofs that are more efficacious per nonzero than the dual proof by decreasing efficacy */
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &efficacies, ndeltas) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &order, ndeltas) );
+
+   ncands = 0;
+   for( i = 0; i < ndeltas; ++i )
+   {
+      if( jobs[i].success && SCIPsetIsFeasPositive(set, jobs[i].efficacy)
+         && jobs[i].efficacy * nnz > proofefficacy * jobs[i].cutnnz )
+      {
+         efficacies[ncands] = jobs[i].efficacy;
+         order[ncands] = i;
+         ++ncands;
+      }
+   }
+   SCIPsortDownRealInt(efficacies, order, ncands);
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &proofvals, nnz) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &proofinds, nnz) );
+
+   nadded = 0;
+   for( i = 0; i < ncands && nadded < maxnproofs; ++i )
+   {
+      ALTPROOFJOB* job = &jobs[order[i]];
+      SCIP_PROOFSET* alternativeproofset;
+      SCIP_Bool redundant;
+      int nchgcoefs;
+      int k;
+
+      /* skip roundings that coincide with a stronger one */
+      for( j = 0; j < i; ++j )
+      {
+         if( altProofsAreEqual(job, &jobs[order[j]], data.epsilon) )
+            break;
+      }
+      if( j < i )
+         continue;
+
+      k = 0;
+      for( j = 0; j < nnz; ++j )
+      {
+         if( job->cutvals[j] != 0.0 ) /*lint !e777*/
+         {
+            proofvals[k] = job->cutvals[j];
+            proofinds[k] = inds[j];
+            ++k;
+         }
+      }
+      assert(k == job->cutnnz);
+
+      SCIP_CALL( proofsetCreate(&alternativeproofset, blkmem) );
+      alternativeproofset->conflicttype = (conflicttype == SCIP_CONFTYPE_INFEASLP ? SCIP_CONFTYPE_ALTINFPROOF : SCIP_CONFTYPE_ALTBNDPROOF);
+      alternativeproofset->validdepth = validdepth;
+
+      SCIP_CALL( proofsetAddSparseData(alternativeproofset, blkmem, proofvals, proofinds, k, job->cutrhs) );
+
+      /* apply coefficient tightening */
+      tightenCoefficients(set, alternativeproofset, &nchgcoefs, &redundant);
+
+      if( !redundant )
+      {
+         SCIPsetDebugMsg(set, "-> add alternative proof from scaled MIR with delta=%g: nnz=%d, efficacy=%g\n",
+               job->delta, job->cutnnz, job->efficacy);
+
+         SCIP_CALL( conflictInsertProofset(conflict, set, alternativeproofset) );
+         ++nadded;
+      }
+      else
+      {
+         SCIPproofsetFree(&alternativeproofset, blkmem);
+      }
+   }
+
+   SCIPsetFreeBufferArray(set, &proofinds);
+   SCIPsetFreeBufferArray(set, &proofvals);
+   SCIPsetFreeBufferArray(set, &order);
+   SCIPsetFreeBufferArray(set, &efficacies);
+   SCIPsetFreeBufferArray(set, &cutvals);
+   SCIPsetFreeBufferArray(set, &jobargs);
+   SCIPsetFreeBufferArray(set, &jobs);
+
+  TERMINATE:
+   SCIPsetFreeBufferArray(set, &deltas);
+   SCIPsetFreeBufferArray(set, &data.integral);
+   SCIPsetFreeBufferArray(set, &data.ubs);
+   SCIPsetFreeBufferArray(set, &data.lbs);
+   SCIPsetFreeBufferArray(set, &data.gubs);
+   SCIPsetFreeBufferArray(set, &data.glbs);
+   SCIPsetFreeBufferArray(set, &data.vals);
+
+   return SCIP_OKAY;
+}
+
 /** try to generate alternative proofs by applying subadditive functions */
 static
 SCIP_RETCODE separateAlternativeProofs(
@@ -1288,6 +1683,7 @@ SCIP_RETCODE separateAlternativeProofs(
    SCIP_TREE*            tree,               /**< tree data */
    BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_AGGRROW*         proofrow,           /**< proof rows data */
+   int                   validdepth,         /**< depth where the proof is valid */
    SCIP_Real*            curvarlbs,          /**< current lower bounds of active problem variables */
    SCIP_Real*            curvarubs,          /**< current upper bounds of active problem variables */
    SCIP_CONFTYPE         conflicttype        /**< type of the conflict */
@@ -1306,6 +1702,7 @@ SCIP_RETCODE separateAlternativeProofs(
    SCIP_Bool infdelta;
    int* cutinds;
    int* inds;
+   int naltproofs;
    int cutnnz;
    int nnz;
    int nvars;
@@ -1356,6 +1753,7 @@ SCIP_RETCODE separateAlternativeProofs(
 
    cutnnz = 0;
    cutefficacy = -SCIPsetInfinity(set);
+   naltproofs = 0;
 
    /* apply flow cover */
    SCIP_CALL( SCIPcalcFlowCover(set->scip, refsol, POSTPROCESS, BOUNDSWITCH, ALLOWLOCAL, proofrow, \
@@ -1377,6 +1775,7 @@ SCIP_RETCODE separateAlternativeProofs(
 
       SCIP_CALL( proofsetCreate(&alternativeproofset, blkmem) );
       alternativeproofset->conflicttype = (conflicttype == SCIP_CONFTYPE_INFEASLP ? SCIP_CONFTYPE_ALTINFPROOF : SCIP_CONFTYPE_ALTBNDPROOF);
+      alternativeproofset->validdepth = validdepth;
 
       SCIP_CALL( proofsetAddSparseData(alternativeproofset, blkmem, cutcoefs, cutinds, cutnnz, cutrhs) );
 
@@ -1386,6 +1785,7 @@ SCIP_RETCODE separateAlternativeProofs(
       if( !redundant )
       {
          SCIP_CALL( conflictInsertProofset(conflict, set, alternativeproofset) );
+         ++naltproofs;
       }
       else
       {
@@ -1398,6 +1798,13 @@ SCIP_RETCODE separateAlternativeProofs(
 
    SCIP_CALL( SCIPfreeSol(set->scip, &refsol) );
 
+   /* fill the remaining slots for alternative proofs with scaled mixed-integer roundings */
+   if( naltproofs < set->conf_maxaltproofs )
+   {
+      SCIP_CALL( addScaledMirProofs(conflict, set, transprob, blkmem, proofrow, validdepth, curvarlbs, curvarubs,
+            conflicttype, set->conf_maxaltproofs - naltproofs) );
+   }
+
    return SCIP_OKAY;
 }
 
@@ -1471,8 +1878,8 @@ SCIP_RETCODE tightenDualproof(
    /* try to find an alternative proof of local infeasibility that is stronger */
    if( set->conf_sepaaltproofs )
    {
-      SCIP_CALL( separateAlternativeProofs(conflict, set, stat, transprob, tree, blkmem, proofrow, curvarlbs, curvarubs,
-            conflict->conflictset->conflicttype) );
+      SCIP_CALL( separateAlternativeProofs(conflict, set, stat, transprob, tree, blkmem, proofrow, validdepth, curvarlbs,
+            curvarubs, conflict->conflictset->conflicttype) );
    }
 
    if( initialproof )
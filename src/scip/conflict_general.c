@@ -189,31 +189,6 @@ SCIP_Longint SCIPconflictGetNAppliedLocalLiterals(
    return conflict->nappliedlocliterals;
 }
 
-/** compares two conflict set entries, such that bound changes inferred later are
- *  ordered prior to ones that were inferred earlier
- */
-static
-SCIP_DECL_SORTPTRCOMP(conflictBdchginfoComp)
-{  /*lint --e{715}*/
-   SCIP_BDCHGINFO* bdchginfo1;
-   SCIP_BDCHGINFO* bdchginfo2;
-
-   bdchginfo1 = (SCIP_BDCHGINFO*)elem1;
-   bdchginfo2 = (SCIP_BDCHGINFO*)elem2;
-   assert(bdchginfo1 != NULL);
-   assert(bdchginfo2 != NULL);
-   assert(!SCIPbdchginfoIsRedundant(bdchginfo1));
-   assert(!SCIPbdchginfoIsRedundant(bdchginfo2));
-
-   if( bdchginfo1 == bdchginfo2 )
-      return 0;
-
-   if( !SCIPbdchgidxIsEarlierNonNull(SCIPbdchginfoGetIdx(bdchginfo1), SCIPbdchginfoGetIdx(bdchginfo2)) )
-      return -1;
-   else
-      return +1;
-}
-
 /** enables or disables all clocks of \p conflict, depending on the value of the flag */
 void SCIPconflictEnableOrDisableClocks(
    SCIP_CONFLICT*        conflict,           /**< the conflict analysis data for which all clocks should be enabled or disabled */
@@ -251,14 +226,17 @@ SCIP_RETCODE SCIPconflictCreate(
    /* enable or disable timing depending on the parameter statistic timing */
    SCIPconflictEnableOrDisableClocks((*conflict), set->time_statistictiming);
 
-   SCIP_CALL( SCIPpqueueCreate(&(*conflict)->bdchgqueue, set->mem_arraygrowinit, set->mem_arraygrowfac,
-         conflictBdchginfoComp, NULL) );
-   SCIP_CALL( SCIPpqueueCreate(&(*conflict)->forcedbdchgqueue, set->mem_arraygrowinit, set->mem_arraygrowfac,
-         conflictBdchginfoComp, NULL) );
+   SCIP_CALL( SCIPbdchgqueueCreate(&(*conflict)->bdchgqueue) );
+   SCIP_CALL( SCIPbdchgqueueCreate(&(*conflict)->forcedbdchgqueue) );
    SCIP_CALL( SCIPconflictsetCreate(&(*conflict)->conflictset, blkmem) );
    (*conflict)->conflictsets = NULL;
    (*conflict)->conflictsetscores = NULL;
    (*conflict)->tmpbdchginfos = NULL;
+   (*conflict)->arenachunks = NULL;
+   (*conflict)->arenachunksizes = NULL;
+   (*conflict)->arenaused = 0;
+   (*conflict)->narenachunks = 0;
+   (*conflict)->arenachunksarraysize = 0;
    (*conflict)->conflictsetssize = 0;
    (*conflict)->nconflictsets = 0;
    (*conflict)->proofsets = NULL;
@@ -326,6 +304,8 @@ SCIP_RETCODE SCIPconflictFree(
    BMS_BLKMEM*           blkmem              /**< block memory of transformed problem */
    )
 {
+   int i;
+
    assert(conflict != NULL);
    assert(*conflict != NULL);
    assert((*conflict)->nconflictsets == 0);
@@ -341,11 +321,18 @@ SCIP_RETCODE SCIPconflictFree(
    SCIPclockFree(&(*conflict)->boundlpanalyzetime);
    SCIPclockFree(&(*conflict)->sbanalyzetime);
    SCIPclockFree(&(*conflict)->pseudoanalyzetime);
-   SCIPpqueueFree(&(*conflict)->bdchgqueue);
-   SCIPpqueueFree(&(*conflict)->forcedbdchgqueue);
+   SCIPbdchgqueueFree(&(*conflict)->bdchgqueue);
+   SCIPbdchgqueueFree(&(*conflict)->forcedbdchgqueue);
    SCIPconflictsetFree(&(*conflict)->conflictset, blkmem);
    SCIPproofsetFree(&(*conflict)->proofset, blkmem);
 
+   for( i = 0; i < (*conflict)->narenachunks; ++i )
+   {
+      BMSfreeMemoryArray(&(*conflict)->arenachunks[i]);
+   }
+   BMSfreeMemoryArrayNull(&(*conflict)->arenachunks);
+   BMSfreeMemoryArrayNull(&(*conflict)->arenachunksizes);
+
    BMSfreeMemoryArrayNull(&(*conflict)->conflictsets);
    BMSfreeMemoryArrayNull(&(*conflict)->conflictsetscores);
    BMSfreeMemoryArrayNull(&(*conflict)->proofsets);
@@ -172,6 +172,9 @@
 /* #define SCIP_CONFGRAPH */
 /* #define SCIP_CONFGRAPH_DOT */
 
+#define CONFLICTARENA_INITSIZE    65536      /**< size of the first chunk of the conflict set arena in bytes */
+#define CONFLICTARENA_ALIGN       sizeof(SCIP_Real) /**< alignment of the memory allocated in the conflict set arena */
+
 
 #if defined(SCIP_CONFGRAPH) || defined(SCIP_CONFGRAPH_DOT)
 /*
@@ -371,6 +374,285 @@ void confgraphMarkConflictset(
 
 #endif
 
+/*
+ * Priority queue of bound changes
+ */
+
+#define BDCHGQUEUE_PARENT(q)      (((q)+1)/2-1)
+#define BDCHGQUEUE_LEFTCHILD(p)   (2*(p)+1)
+#define BDCHGQUEUE_RIGHTCHILD(p)  (2*(p)+2)
+
+/** returns the key of a bound change in the priority queue, which orders the bound changes by depth and position */
+static
+SCIP_Longint bdchginfoGetQueueKey(
+   SCIP_BDCHGINFO*       bdchginfo           /**< bound change information */
+   )
+{
+   assert(SCIPbdchginfoGetDepth(bdchginfo) >= -2);
+   assert(SCIPbdchginfoGetPos(bdchginfo) >= 0);
+
+   return (SCIP_Longint)SCIPbdchginfoGetDepth(bdchginfo) * 4294967296LL + SCIPbdchginfoGetPos(bdchginfo);
+}
+
+/** creates an empty priority queue of bound changes */
+SCIP_RETCODE SCIPbdchgqueueCreate(
+   SCIP_BDCHGQUEUE**     bdchgqueue          /**< pointer to store the priority queue */
+   )
+{
+   assert(bdchgqueue != NULL);
+
+   SCIP_ALLOC( BMSallocMemory(bdchgqueue) );
+   (*bdchgqueue)->bdchginfos = NULL;
+   (*bdchgqueue)->keys = NULL;
+   (*bdchgqueue)->len = 0;
+   (*bdchgqueue)->size = 0;
+
+   return SCIP_OKAY;
+}
+
+/** frees a priority queue of bound changes, but not the bound changes themselves */
+void SCIPbdchgqueueFree(
+   SCIP_BDCHGQUEUE**     bdchgqueue          /**< pointer to the priority queue */
+   )
+{
+   assert(bdchgqueue != NULL);
+   assert(*bdchgqueue != NULL);
+
+   BMSfreeMemoryArrayNull(&(*bdchgqueue)->keys);
+   BMSfreeMemoryArrayNull(&(*bdchgqueue)->bdchginfos);
+   BMSfreeMemory(bdchgqueue);
+}
+
+/** returns the number of bound changes in the priority queue */
+int SCIPbdchgqueueNElems(
+   SCIP_BDCHGQUEUE*      bdchgqueue          /**< priority queue of bound changes */
+   )
+{
+   assert(bdchgqueue != NULL);
+
+   return bdchgqueue->len;
+}
+
+/** returns the bound changes of the priority queue in heap order */
+SCIP_BDCHGINFO** SCIPbdchgqueueElems(
+   SCIP_BDCHGQUEUE*      bdchgqueue          /**< priority queue of bound changes */
+   )
+{
+   assert(bdchgqueue != NULL);
+
+   return bdchgqueue->bdchginfos;
+}
+
+/** removes all bound changes from the priority queue */
+static
+void bdchgqueueClear(
+   SCIP_BDCHGQUEUE*      bdchgqueue          /**< priority queue of bound changes */
+   )
+{
+   assert(bdchgqueue != NULL);
+
+   bdchgqueue->len = 0;
+}
+
+/** inserts a bound change into the priority queue
+ *
+ *  Bound changes with larger keys, i.e., that were applied later, come first. The heap operations are the same as the
+ *  ones of SCIP_PQUEUE, such that the bound changes are processed in the same order.
+ */
+static
+SCIP_RETCODE bdchgqueueInsert(
+   SCIP_BDCHGQUEUE*      bdchgqueue,         /**< priority queue of bound changes */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_BDCHGINFO*       bdchginfo           /**< bound change to insert */
+   )
+{
+   SCIP_Longint key;
+   int parentpos;
+   int pos;
+
+   assert(bdchgqueue != NULL);
+   assert(bdchginfo != NULL);
+
+   if( bdchgqueue->len == bdchgqueue->size )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, bdchgqueue->len + 1);
+      SCIP_ALLOC( BMSreallocMemoryArray(&bdchgqueue->bdchginfos, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&bdchgqueue->keys, newsize) );
+      bdchgqueue->size = newsize;
+   }
+
+   /* insert bound change as leaf in the tree, move it towards the root as long as it is not earlier than its parent */
+   key = bdchginfoGetQueueKey(bdchginfo);
+   pos = bdchgqueue->len;
+   bdchgqueue->len++;
+   parentpos = BDCHGQUEUE_PARENT(pos);
+   while( pos > 0 && key >= bdchgqueue->keys[parentpos] && bdchginfo != bdchgqueue->bdchginfos[parentpos] )
+   {
+      bdchgqueue->bdchginfos[pos] = bdchgqueue->bdchginfos[parentpos];
+      bdchgqueue->keys[pos] = bdchgqueue->keys[parentpos];
+
+      pos = parentpos;
+      parentpos = BDCHGQUEUE_PARENT(pos);
+   }
+
+   bdchgqueue->bdchginfos[pos] = bdchginfo;
+   bdchgqueue->keys[pos] = key;
+
+   return SCIP_OKAY;
+}
+
+/** returns the latest bound change of the priority queue without removing it, or NULL if the queue is empty */
+static
+SCIP_BDCHGINFO* bdchgqueueFirst(
+   SCIP_BDCHGQUEUE*      bdchgqueue          /**< priority queue of bound changes */
+   )
+{
+   assert(bdchgqueue != NULL);
+
+   if( bdchgqueue->len == 0 )
+      return NULL;
+
+   return bdchgqueue->bdchginfos[0];
+}
+
+/** removes and returns the latest bound change of the priority queue, or NULL if the queue is empty */
+static
+SCIP_BDCHGINFO* bdchgqueueRemove(
+   SCIP_BDCHGQUEUE*      bdchgqueue          /**< priority queue of bound changes */
+   )
+{
+   SCIP_BDCHGINFO* root;
+   SCIP_BDCHGINFO* last;
+   SCIP_Longint lastkey;
+   int pos;
+
+   assert(bdchgqueue != NULL);
+
+   if( bdchgqueue->len == 0 )
+      return NULL;
+
+   root = bdchgqueue->bdchginfos[0];
+   bdchgqueue->len--;
+
+   if( bdchgqueue->len == 0 )
+      return root;
+
+   /* move the better child to its parent's position until the last bound change can be placed in the empty slot */
+   last = bdchgqueue->bdchginfos[bdchgqueue->len];
+   lastkey = bdchgqueue->keys[bdchgqueue->len];
+   pos = 0;
+   while( pos <= BDCHGQUEUE_PARENT(bdchgqueue->len-1) )
+   {
+      int childpos = BDCHGQUEUE_LEFTCHILD(pos);
+      int brotherpos = BDCHGQUEUE_RIGHTCHILD(pos);
+
+      if( brotherpos < bdchgqueue->len && bdchgqueue->keys[brotherpos] >= bdchgqueue->keys[childpos]
+         && bdchgqueue->bdchginfos[brotherpos] != bdchgqueue->bdchginfos[childpos] )
+         childpos = brotherpos;
+
+      if( lastkey >= bdchgqueue->keys[childpos] || last == bdchgqueue->bdchginfos[childpos] )
+         break;
+
+      bdchgqueue->bdchginfos[pos] = bdchgqueue->bdchginfos[childpos];
+      bdchgqueue->keys[pos] = bdchgqueue->keys[childpos];
+
+      pos = childpos;
+   }
+
+   bdchgqueue->bdchginfos[pos] = last;
+   bdchgqueue->keys[pos] = lastkey;
+
+   return root;
+}
+
+
+/*
+ * Arena for the arrays of the conflict sets found at the current node
+ */
+
+/** allocates memory in the conflict set arena; the memory is released when the arena is reset */
+static
+SCIP_RETCODE conflictArenaAlloc(
+   SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
+   size_t                size,               /**< number of bytes to allocate */
+   void**                ptr                 /**< pointer to store the allocated memory */
+   )
+{
+   assert(conflict != NULL);
+   assert(ptr != NULL);
+
+   size = ((size + CONFLICTARENA_ALIGN - 1) / CONFLICTARENA_ALIGN) * CONFLICTARENA_ALIGN;
+
+   /* start a new chunk, which is at least twice as large as the previous one, if the last chunk is full */
+   if( conflict->narenachunks == 0
+      || conflict->arenaused + size > conflict->arenachunksizes[conflict->narenachunks-1] )
+   {
+      size_t chunksize;
+
+      if( conflict->narenachunks == conflict->arenachunksarraysize )
+      {
+         int newsize;
+
+         newsize = MAX(4, 2 * conflict->arenachunksarraysize);
+         SCIP_ALLOC( BMSreallocMemoryArray(&conflict->arenachunks, newsize) );
+         SCIP_ALLOC( BMSreallocMemoryArray(&conflict->arenachunksizes, newsize) );
+         conflict->arenachunksarraysize = newsize;
+      }
+
+      if( conflict->narenachunks == 0 )
+         chunksize = CONFLICTARENA_INITSIZE;
+      else
+         chunksize = 2 * conflict->arenachunksizes[conflict->narenachunks-1];
+      chunksize = MAX(chunksize, size);
+
+      SCIP_ALLOC( BMSallocMemoryArray(&conflict->arenachunks[conflict->narenachunks], chunksize) );
+      conflict->arenachunksizes[conflict->narenachunks] = chunksize;
+      conflict->narenachunks++;
+      conflict->arenaused = 0;
+   }
+
+   *ptr = (void*)(conflict->arenachunks[conflict->narenachunks-1] + conflict->arenaused);
+   conflict->arenaused += size;
+
+   return SCIP_OKAY;
+}
+
+/** resets the conflict set arena after all conflict sets allocated in it have been freed
+ *
+ *  If the arena consists of several chunks, they are replaced by one chunk of the total size, such that the arena does
+ *  not need to grow again for a conflict analysis of the same size.
+ */
+static
+SCIP_RETCODE conflictArenaReset(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
+   )
+{
+   assert(conflict != NULL);
+   assert(conflict->nconflictsets == 0);
+
+   if( conflict->narenachunks > 1 )
+   {
+      size_t totalsize = 0;
+      int i;
+
+      for( i = 0; i < conflict->narenachunks; ++i )
+      {
+         totalsize += conflict->arenachunksizes[i];
+         BMSfreeMemoryArray(&conflict->arenachunks[i]);
+      }
+
+      SCIP_ALLOC( BMSallocMemoryArray(&conflict->arenachunks[0], totalsize) );
+      conflict->arenachunksizes[0] = totalsize;
+      conflict->narenachunks = 1;
+   }
+   conflict->arenaused = 0;
+
+   return SCIP_OKAY;
+}
+
+
 /** Conflict sets */
 
 /** resizes the arrays of the conflict set to be able to store at least num bound change entries */
@@ -390,9 +672,31 @@ SCIP_RETCODE conflictsetEnsureBdchginfosMem(
       int newsize;
 
       newsize = SCIPsetCalcMemGrowSize(set, num);
-      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictset->bdchginfos, conflictset->bdchginfossize, newsize) );
-      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictset->relaxedbds, conflictset->bdchginfossize, newsize) );
-      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictset->sortvals, conflictset->bdchginfossize, newsize) );
+
+      /* arrays in the conflict set arena cannot be resized, so they are moved to block memory */
+      if( conflictset->arraysinarena )
+      {
+         SCIP_BDCHGINFO** bdchginfos;
+         SCIP_Real* relaxedbds;
+         int* sortvals;
+
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &bdchginfos, newsize) );
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &relaxedbds, newsize) );
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &sortvals, newsize) );
+         BMScopyMemoryArray(bdchginfos, conflictset->bdchginfos, conflictset->nbdchginfos);
+         BMScopyMemoryArray(relaxedbds, conflictset->relaxedbds, conflictset->nbdchginfos);
+         BMScopyMemoryArray(sortvals, conflictset->sortvals, conflictset->nbdchginfos);
+         conflictset->bdchginfos = bdchginfos;
+         conflictset->relaxedbds = relaxedbds;
+         conflictset->sortvals = sortvals;
+         conflictset->arraysinarena = FALSE;
+      }
+      else
+      {
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictset->bdchginfos, conflictset->bdchginfossize, newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictset->relaxedbds, conflictset->bdchginfossize, newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictset->sortvals, conflictset->bdchginfossize, newsize) );
+      }
       conflictset->bdchginfossize = newsize;
    }
    assert(num <= conflictset->bdchginfossize);
@@ -998,17 +1302,23 @@ SCIP_RETCODE SCIPconflictsetCreate(
    (*conflictset)->relaxedbds = NULL;
    (*conflictset)->sortvals = NULL;
    (*conflictset)->bdchginfossize = 0;
+   (*conflictset)->arraysinarena = FALSE;
 
    conflictsetClear(*conflictset);
 
    return SCIP_OKAY;
 }
 
-/** creates a copy of the given conflict set, allocating an additional amount of memory */
+/** creates a copy of the given conflict set, allocating an additional amount of memory
+ *
+ *  The arrays of the copy are allocated in the conflict set arena, such that the copy must be freed before the conflict
+ *  sets are flushed.
+ */
 static
 SCIP_RETCODE conflictsetCopy(
    SCIP_CONFLICTSET**    targetconflictset,  /**< pointer to store the conflict set */
    BMS_BLKMEM*           blkmem,             /**< block memory of transformed problem */
+   SCIP_CONFLICT*        conflict,           /**< conflict analysis data holding the conflict set arena */
    SCIP_CONFLICTSET*     sourceconflictset,  /**< source conflict set */
    int                   nadditionalelems    /**< number of additional elements to allocate memory for */
    )
@@ -1016,14 +1326,17 @@ SCIP_RETCODE conflictsetCopy(
    int targetsize;
 
    assert(targetconflictset != NULL);
+   assert(conflict != NULL);
    assert(sourceconflictset != NULL);
 
    targetsize = sourceconflictset->nbdchginfos + nadditionalelems;
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, targetconflictset) );
-   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*targetconflictset)->bdchginfos, targetsize) );
-   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*targetconflictset)->relaxedbds, targetsize) );
-   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*targetconflictset)->sortvals, targetsize) );
+   SCIP_CALL( conflictArenaAlloc(conflict, targetsize * sizeof(SCIP_BDCHGINFO*),
+         (void**)&(*targetconflictset)->bdchginfos) );
+   SCIP_CALL( conflictArenaAlloc(conflict, targetsize * sizeof(SCIP_Real), (void**)&(*targetconflictset)->relaxedbds) );
+   SCIP_CALL( conflictArenaAlloc(conflict, targetsize * sizeof(int), (void**)&(*targetconflictset)->sortvals) );
    (*targetconflictset)->bdchginfossize = targetsize;
+   (*targetconflictset)->arraysinarena = TRUE;
 
    BMScopyMemoryArray((*targetconflictset)->bdchginfos, sourceconflictset->bdchginfos, sourceconflictset->nbdchginfos);
    BMScopyMemoryArray((*targetconflictset)->relaxedbds, sourceconflictset->relaxedbds, sourceconflictset->nbdchginfos);
@@ -1050,9 +1363,13 @@ void SCIPconflictsetFree(
    assert(conflictset != NULL);
    assert(*conflictset != NULL);
 
-   BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictset)->bdchginfos, (*conflictset)->bdchginfossize);
-   BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictset)->relaxedbds, (*conflictset)->bdchginfossize);
-   BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictset)->sortvals, (*conflictset)->bdchginfossize);
+   /* arrays in the conflict set arena are released when the arena is reset */
+   if( !(*conflictset)->arraysinarena )
+   {
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictset)->bdchginfos, (*conflictset)->bdchginfossize);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictset)->relaxedbds, (*conflictset)->bdchginfossize);
+      BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictset)->sortvals, (*conflictset)->bdchginfossize);
+   }
    BMSfreeBlockMemory(blkmem, conflictset);
 }
 
@@ -2113,6 +2430,9 @@ SCIP_RETCODE SCIPconflictFlushConss(
          SCIPconflictsetFree(&conflict->conflictsets[i], blkmem);
       }
       conflict->nconflictsets = 0;
+
+      /* release the arrays of the freed conflict sets */
+      SCIP_CALL( conflictArenaReset(conflict) );
    }
 
    /* free all temporarily created bound change information data */
@@ -2421,11 +2741,11 @@ SCIP_RETCODE conflictQueueBound(
       if( (!set->conf_preferbinary || SCIPvarIsBinary(SCIPbdchginfoGetVar(bdchginfo)))
          && !isBoundchgUseless(set, bdchginfo) )
       {
-         SCIP_CALL( SCIPpqueueInsert(conflict->bdchgqueue, (void*)bdchginfo) );
+         SCIP_CALL( bdchgqueueInsert(conflict->bdchgqueue, set, bdchginfo) );
       }
       else
       {
-         SCIP_CALL( SCIPpqueueInsert(conflict->forcedbdchgqueue, (void*)bdchginfo) );
+         SCIP_CALL( bdchgqueueInsert(conflict->forcedbdchgqueue, set, bdchginfo) );
       }
 
 #if defined(SCIP_CONFGRAPH) || defined(SCIP_CONFGRAPH_DOT)
@@ -2892,10 +3212,10 @@ SCIP_BDCHGINFO* conflictRemoveCand(
 
    assert(conflict != NULL);
 
-   if( SCIPpqueueNElems(conflict->forcedbdchgqueue) > 0 )
-      bdchginfo = (SCIP_BDCHGINFO*)(SCIPpqueueRemove(conflict->forcedbdchgqueue));
+   if( SCIPbdchgqueueNElems(conflict->forcedbdchgqueue) > 0 )
+      bdchginfo = bdchgqueueRemove(conflict->forcedbdchgqueue);
    else
-      bdchginfo = (SCIP_BDCHGINFO*)(SCIPpqueueRemove(conflict->bdchgqueue));
+      bdchginfo = bdchgqueueRemove(conflict->bdchgqueue);
 
    assert(!SCIPbdchginfoIsRedundant(bdchginfo));
 
@@ -2935,10 +3255,10 @@ SCIP_BDCHGINFO* conflictFirstCand(
 
    assert(conflict != NULL);
 
-   if( SCIPpqueueNElems(conflict->forcedbdchgqueue) > 0 )
+   if( SCIPbdchgqueueNElems(conflict->forcedbdchgqueue) > 0 )
    {
       /* get next potential candidate */
-      bdchginfo = (SCIP_BDCHGINFO*)(SCIPpqueueFirst(conflict->forcedbdchgqueue));
+      bdchginfo = bdchgqueueFirst(conflict->forcedbdchgqueue);
 
       /* check if this candidate is valid */
       if( bdchginfoIsInvalid(conflict, bdchginfo) )
@@ -2949,7 +3269,7 @@ SCIP_BDCHGINFO* conflictFirstCand(
             SCIPbdchginfoGetNewbound(bdchginfo));
 
          /* pop the invalid bound change info from the queue */
-         (void)(SCIPpqueueRemove(conflict->forcedbdchgqueue));
+         (void)bdchgqueueRemove(conflict->forcedbdchgqueue);
 
          /* call method recursively to get next conflict analysis candidate */
          bdchginfo = conflictFirstCand(conflict);
@@ -2957,7 +3277,7 @@ SCIP_BDCHGINFO* conflictFirstCand(
    }
    else
    {
-      bdchginfo = (SCIP_BDCHGINFO*)(SCIPpqueueFirst(conflict->bdchgqueue));
+      bdchginfo = bdchgqueueFirst(conflict->bdchgqueue);
 
       /* check if this candidate is valid */
       if( bdchginfo != NULL && bdchginfoIsInvalid(conflict, bdchginfo) )
@@ -2968,7 +3288,7 @@ SCIP_BDCHGINFO* conflictFirstCand(
             SCIPbdchginfoGetNewbound(bdchginfo));
 
          /* pop the invalid bound change info from the queue */
-         (void)(SCIPpqueueRemove(conflict->bdchgqueue));
+         (void)bdchgqueueRemove(conflict->bdchgqueue);
 
          /* call method recursively to get next conflict analysis candidate */
          bdchginfo = conflictFirstCand(conflict);
@@ -3007,7 +3327,7 @@ SCIP_RETCODE conflictAddConflictset(
    assert(tree != NULL);
    assert(success != NULL);
    assert(nliterals != NULL);
-   assert(SCIPpqueueNElems(conflict->forcedbdchgqueue) == 0);
+   assert(SCIPbdchgqueueNElems(conflict->forcedbdchgqueue) == 0);
 
    *success = FALSE;
    *nliterals = 0;
@@ -3025,11 +3345,11 @@ SCIP_RETCODE conflictAddConflictset(
    assert(0 <= validdepth && validdepth <= currentdepth);
 
    /* get the elements of the bound change queue */
-   bdchginfos = (SCIP_BDCHGINFO**)SCIPpqueueElems(conflict->bdchgqueue);
-   nbdchginfos = SCIPpqueueNElems(conflict->bdchgqueue);
+   bdchginfos = SCIPbdchgqueueElems(conflict->bdchgqueue);
+   nbdchginfos = SCIPbdchgqueueNElems(conflict->bdchgqueue);
 
    /* create a copy of the current conflict set, allocating memory for the additional elements of the queue */
-   SCIP_CALL( conflictsetCopy(&conflictset, blkmem, conflict->conflictset, nbdchginfos) );
+   SCIP_CALL( conflictsetCopy(&conflictset, blkmem, conflict, conflict->conflictset, nbdchginfos) );
    conflictset->validdepth = validdepth;
    conflictset->repropagate = repropagate;
 
@@ -3100,8 +3420,8 @@ SCIP_RETCODE conflictResolveBound(
 
    /* store the current size of the conflict queues */
    assert(conflict != NULL);
-   nforcedbdchgqueue = SCIPpqueueNElems(conflict->forcedbdchgqueue);
-   nbdchgqueue = SCIPpqueueNElems(conflict->bdchgqueue);
+   nforcedbdchgqueue = SCIPbdchgqueueNElems(conflict->forcedbdchgqueue);
+   nbdchgqueue = SCIPbdchgqueueNElems(conflict->bdchgqueue);
 #else
    assert(conflict != NULL);
 #endif
@@ -3142,9 +3462,9 @@ SCIP_RETCODE conflictResolveBound(
       SCIPsetDebugMsgPrint(set, "\n");
       SCIPsetDebugMsg(set, " - forced candidates  :");
 
-      for( i = 0; i < SCIPpqueueNElems(conflict->forcedbdchgqueue); ++i )
+      for( i = 0; i < SCIPbdchgqueueNElems(conflict->forcedbdchgqueue); ++i )
       {
-         SCIP_BDCHGINFO* info = (SCIP_BDCHGINFO*)(SCIPpqueueElems(conflict->forcedbdchgqueue)[i]);
+         SCIP_BDCHGINFO* info = SCIPbdchgqueueElems(conflict->forcedbdchgqueue)[i];
          SCIPsetDebugMsgPrint(set, " [%d:<%s> %s %g(%g)]", SCIPbdchginfoGetDepth(info), SCIPvarGetName(SCIPbdchginfoGetVar(info)),
                bdchginfoIsInvalid(conflict, info) ? "<!>" : SCIPbdchginfoGetBoundtype(info) == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=",
                      SCIPbdchginfoGetNewbound(info), SCIPbdchginfoGetRelaxedBound(info));
@@ -3152,9 +3472,9 @@ SCIP_RETCODE conflictResolveBound(
       SCIPsetDebugMsgPrint(set, "\n");
       SCIPsetDebugMsg(set, " - optional candidates:");
 
-      for( i = 0; i < SCIPpqueueNElems(conflict->bdchgqueue); ++i )
+      for( i = 0; i < SCIPbdchgqueueNElems(conflict->bdchgqueue); ++i )
       {
-         SCIP_BDCHGINFO* info = (SCIP_BDCHGINFO*)(SCIPpqueueElems(conflict->bdchgqueue)[i]);
+         SCIP_BDCHGINFO* info = SCIPbdchgqueueElems(conflict->bdchgqueue)[i];
          SCIPsetDebugMsgPrint(set, " [%d:<%s> %s %g(%g)]", SCIPbdchginfoGetDepth(info), SCIPvarGetName(SCIPbdchginfoGetVar(info)),
                bdchginfoIsInvalid(conflict, info) ? "<!>" : SCIPbdchginfoGetBoundtype(info) == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=",
                      SCIPbdchginfoGetNewbound(info), SCIPbdchginfoGetRelaxedBound(info));
@@ -3278,8 +3598,8 @@ SCIP_RETCODE conflictResolveBound(
 
 #ifndef NDEBUG
    /* subtract the size of the conflicq queues */
-   nforcedbdchgqueue -= SCIPpqueueNElems(conflict->forcedbdchgqueue);
-   nbdchgqueue -= SCIPpqueueNElems(conflict->bdchgqueue);
+   nforcedbdchgqueue -= SCIPbdchgqueueNElems(conflict->forcedbdchgqueue);
+   nbdchgqueue -= SCIPbdchgqueueNElems(conflict->bdchgqueue);
 
    /* in case the bound change was not resolved, the conflict queues should have the same size (contents) */
    assert((*resolved) || (nforcedbdchgqueue == 0 && nbdchgqueue == 0));
@@ -3296,8 +3616,8 @@ void conflictClear(
 {
    assert(conflict != NULL);
 
-   SCIPpqueueClear(conflict->bdchgqueue);
-   SCIPpqueueClear(conflict->forcedbdchgqueue);
+   bdchgqueueClear(conflict->bdchgqueue);
+   bdchgqueueClear(conflict->forcedbdchgqueue);
    conflictsetClear(conflict->conflictset);
 }
 
@@ -3526,7 +3846,7 @@ SCIP_RETCODE conflictCreateReconvergenceConss(
          int bdchgdepth;
 
          /* check if the next bound change must be resolved in every case */
-         forceresolve = (SCIPpqueueNElems(conflict->forcedbdchgqueue) > 0);
+         forceresolve = (SCIPbdchgqueueNElems(conflict->forcedbdchgqueue) > 0);
 
          /* remove currently processed candidate and get next conflicting bound from the conflict candidate queue before
           * we remove the candidate we have to collect the relaxed bound since removing the candidate from the queue
@@ -3711,7 +4031,7 @@ SCIP_RETCODE conflictAnalyze(
       resolvedepth = MIN(resolvedepth, currentdepth);
 
    SCIPsetDebugMsg(set, "analyzing conflict with %d+%d conflict candidates and starting conflict set of size %d in depth %d (resolvedepth=%d)\n",
-      SCIPpqueueNElems(conflict->forcedbdchgqueue), SCIPpqueueNElems(conflict->bdchgqueue),
+      SCIPbdchgqueueNElems(conflict->forcedbdchgqueue), SCIPbdchgqueueNElems(conflict->bdchgqueue),
       conflict->conflictset->nbdchginfos, currentdepth, resolvedepth);
 
    *nconss = 0;
@@ -3753,7 +4073,7 @@ SCIP_RETCODE conflictAnalyze(
       assert(!SCIPbdchginfoIsRedundant(bdchginfo));
 
       /* check if the next bound change must be resolved in every case */
-      forceresolve = (SCIPpqueueNElems(conflict->forcedbdchgqueue) > 0);
+      forceresolve = (SCIPbdchgqueueNElems(conflict->forcedbdchgqueue) > 0);
 
       /* resolve next bound change in queue */
       bdchgdepth = SCIPbdchginfoGetDepth(bdchginfo);
@@ -3787,7 +4107,7 @@ SCIP_RETCODE conflictAnalyze(
             /* call the conflict handlers to create a conflict set */
             SCIPsetDebugMsg(set, "creating intermediate conflictset after %d resolutions up to depth %d (valid at depth %d): %d conflict bounds, %d bounds in queue\n",
                nresolutions, bdchgdepth, validdepth, conflict->conflictset->nbdchginfos,
-               SCIPpqueueNElems(conflict->bdchgqueue));
+               SCIPbdchgqueueNElems(conflict->bdchgqueue));
 
             SCIP_CALL( conflictAddConflictset(conflict, blkmem, set, stat, tree, validdepth, diving, TRUE, &success, &nlits) );
             lastconsnresolutions = nresolutions;
@@ -3894,7 +4214,7 @@ SCIP_RETCODE conflictAnalyze(
       && nresolutions > lastconsnresolutions
       && validdepth <= maxvaliddepth
       && (!mustresolve || nresolutions > 0 || conflict->conflictset->nbdchginfos == 0)
-      && SCIPpqueueNElems(conflict->forcedbdchgqueue) == 0 )
+      && SCIPbdchgqueueNElems(conflict->forcedbdchgqueue) == 0 )
    {
       int nlits;
       SCIP_Bool success;
@@ -5474,8 +5794,8 @@ SCIP_RETCODE SCIPconflictAnalyze(
       return SCIP_OKAY;
 
    /* check, if the conflict set will get too large with high probability */
-   if( conflict->conflictset->nbdchginfos + SCIPpqueueNElems(conflict->bdchgqueue)
-      + SCIPpqueueNElems(conflict->forcedbdchgqueue) >= 2*conflictCalcMaxsize(set, prob) )
+   if( conflict->conflictset->nbdchginfos + SCIPbdchgqueueNElems(conflict->bdchgqueue)
+      + SCIPbdchgqueueNElems(conflict->forcedbdchgqueue) >= 2*conflictCalcMaxsize(set, prob) )
       return SCIP_OKAY;
 
    SCIPsetDebugMsg(set, "analyzing conflict after infeasible propagation in depth %d\n", SCIPtreeGetCurrentDepth(tree));
@@ -163,6 +163,26 @@ void SCIPconflictsetFree(
    BMS_BLKMEM*           blkmem              /**< block memory of transformed problem */
    );
 
+/** creates an empty priority queue of bound changes */
+SCIP_RETCODE SCIPbdchgqueueCreate(
+   SCIP_BDCHGQUEUE**     bdchgqueue          /**< pointer to store the priority queue */
+   );
+
+/** frees a priority queue of bound changes, but not the bound changes themselves */
+void SCIPbdchgqueueFree(
+   SCIP_BDCHGQUEUE**     bdchgqueue          /**< pointer to the priority queue */
+   );
+
+/** returns the number of bound changes in the priority queue */
+int SCIPbdchgqueueNElems(
+   SCIP_BDCHGQUEUE*      bdchgqueue          /**< priority queue of bound changes */
+   );
+
+/** returns the bound changes of the priority queue in heap order */
+SCIP_BDCHGINFO** SCIPbdchgqueueElems(
+   SCIP_BDCHGQUEUE*      bdchgqueue          /**< priority queue of bound changes */
+   );
+
 /** copies the given conflict handler to a new scip */
 SCIP_RETCODE SCIPconflicthdlrCopyInclude(
    SCIP_CONFLICTHDLR*    conflicthdlr,       /**< conflict handler */
@@ -43,7 +43,10 @@
 #include "scip/reopt.h"
 #include "scip/scip.h"
 #include "scip/def.h"
+#include "scip/var.h"
+#include "scip/cons_bounddisjunction.h"
 #include "scip/cons_linear.h"
+#include "scip/cons_logicor.h"
 #include "scip/struct_conflictstore.h"
 
 
@@ -53,6 +56,8 @@
 #define CONFLICTSTORE_MAXSIZE    60000 /* maximal size of a dynamic conflict store (multiplied by 3) */
 #define CONFLICTSTORE_SIZE       10000 /* default size of conflict store */
 #define CONFLICTSTORE_SORTFREQ      20 /* frequency to resort the conflict array */
+#define CONFLICTSTORE_CORELBD        2 /* maximal literal block distance of conflicts in the core tier */
+#define CONFLICTSTORE_TIER2LBD       6 /* maximal literal block distance of conflicts in the middle tier */
 
 /* event handler properties */
 #define EVENTHDLR_NAME         "ConflictStore"
@@ -168,6 +173,240 @@ SCIP_DECL_SORTPTRCOMP(compareConss)
 #endif
 }
 
+/** returns the retention tier of a conflict with the given literal block distance
+ *
+ *  Conflicts in the core tier (0) consist of literals that became false at very few depths and are removed last;
+ *  conflicts with many distinct depths (tier 2) are removed first. Conflicts with unknown literal block distance are
+ *  assigned to the middle tier.
+ */
+static
+int getConflictTier(
+   int                   lbd                 /**< literal block distance of the conflict, or -1 if unknown */
+   )
+{
+   if( lbd < 0 )
+      return 1;
+   else if( lbd <= CONFLICTSTORE_CORELBD )
+      return 0;
+   else if( lbd <= CONFLICTSTORE_TIER2LBD )
+      return 1;
+   else
+      return 2;
+}
+
+/* comparison method for the positions of conflicts in the store: conflicts of higher tiers come first, conflicts of the
+ * same tier are compared by compareConss()
+ */
+static
+SCIP_DECL_SORTINDCOMP(compareConflicts)
+{
+   SCIP_CONFLICTSTORE* conflictstore = (SCIP_CONFLICTSTORE*)dataptr;
+   int tier1;
+   int tier2;
+
+   assert(conflictstore != NULL);
+
+   tier1 = getConflictTier(conflictstore->conflbds[ind1]);
+   tier2 = getConflictTier(conflictstore->conflbds[ind2]);
+
+   if( tier1 != tier2 )
+      return tier2 - tier1;
+
+   return compareConss((void*)conflictstore->conflicts[ind1], (void*)conflictstore->conflicts[ind2]);
+}
+
+/** gets the literals of a conflict of the logicor or bounddisjunction constraint handler
+ *
+ *  The literals of a logicor constraint are given by its variables only, each variable x representing the literal
+ *  x >= 1; in this case, boundtypes and bounds are set to NULL.
+ *
+ *  @return TRUE if the literals of the conflict are known, FALSE otherwise
+ */
+static
+SCIP_Bool getConflictLiterals(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_CONS*            cons,               /**< conflict constraint */
+   SCIP_VAR***           vars,               /**< pointer to store the variables of the literals */
+   SCIP_BOUNDTYPE**      boundtypes,         /**< pointer to store the bound types of the literals */
+   SCIP_Real**           bounds,             /**< pointer to store the bounds of the literals */
+   int*                  nliterals           /**< pointer to store the number of literals */
+   )
+{
+   const char* conshdlrname;
+
+   assert(cons != NULL);
+
+   conshdlrname = SCIPconshdlrGetName(SCIPconsGetHdlr(cons));
+
+   if( strcmp(conshdlrname, "logicor") == 0 )
+   {
+      *vars = SCIPgetVarsLogicor(set->scip, cons);
+      *boundtypes = NULL;
+      *bounds = NULL;
+      *nliterals = SCIPgetNVarsLogicor(set->scip, cons);
+
+      return TRUE;
+   }
+   else if( strcmp(conshdlrname, "bounddisjunction") == 0 )
+   {
+      *vars = SCIPgetVarsBounddisjunction(set->scip, cons);
+      *boundtypes = SCIPgetBoundtypesBounddisjunction(set->scip, cons);
+      *bounds = SCIPgetBoundsBounddisjunction(set->scip, cons);
+      *nliterals = SCIPgetNVarsBounddisjunction(set->scip, cons);
+
+      return TRUE;
+   }
+
+   return FALSE;
+}
+
+/** computes the bit signature of the variables of a conflict, or 0 if the literals of the conflict are unknown */
+static
+uint64_t calcConflictSignature(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_CONS*            cons                /**< conflict constraint */
+   )
+{
+   SCIP_BOUNDTYPE* boundtypes;
+   SCIP_VAR** vars;
+   SCIP_Real* bounds;
+   uint64_t signature = 0;
+   int nliterals;
+   int i;
+
+   if( !getConflictLiterals(set, cons, &vars, &boundtypes, &bounds, &nliterals) )
+      return 0;
+
+   for( i = 0; i < nliterals; ++i )
+      signature |= SCIPhashSignature64(SCIPvarGetIndex(vars[i]));
+
+   return signature;
+}
+
+/** computes the literal block distance of a conflict, i.e., the number of distinct positive depths at which its literals
+ *  became false at the current node, or -1 if the literals of the conflict are unknown
+ */
+static
+SCIP_RETCODE calcConflictLbd(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_CONS*            cons,               /**< conflict constraint */
+   int*                  lbd                 /**< pointer to store the literal block distance */
+   )
+{
+   SCIP_BOUNDTYPE* boundtypes;
+   SCIP_VAR** vars;
+   SCIP_Real* bounds;
+   int* depths;
+   int nliterals;
+   int ndepths;
+   int i;
+
+   assert(lbd != NULL);
+
+   *lbd = -1;
+
+   if( !getConflictLiterals(set, cons, &vars, &boundtypes, &bounds, &nliterals) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &depths, nliterals) );
+   ndepths = 0;
+
+   for( i = 0; i < nliterals; ++i )
+   {
+      SCIP_BOUNDTYPE boundtype;
+      SCIP_VAR* var;
+      SCIP_Real bound;
+      int depth;
+
+      var = vars[i];
+      boundtype = (boundtypes == NULL ? SCIP_BOUNDTYPE_LOWER : boundtypes[i]);
+      bound = (bounds == NULL ? 1.0 : bounds[i]);
+
+      SCIP_CALL( SCIPvarGetProbvarBound(&var, &bound, &boundtype) );
+
+      if( var == NULL || !SCIPvarIsActive(var) )
+         continue;
+
+      /* the literal var >= bound (var <= bound) became false at the depth of the conflicting bound change */
+      depth = SCIPvarGetConflictingBdchgDepth(var, set, boundtype, bound);
+
+      if( depth > 0 )
+         depths[ndepths++] = depth;
+   }
+
+   SCIPsortInt(depths, ndepths);
+
+   *lbd = 0;
+   for( i = 0; i < ndepths; ++i )
+   {
+      if( i == 0 || depths[i] != depths[i-1] )
+         ++(*lbd);
+   }
+
+   SCIPsetFreeBufferArray(set, &depths);
+
+   return SCIP_OKAY;
+}
+
+/** checks whether the first conflict implies the second one, i.e., whether each literal of the first conflict implies a
+ *  literal of the second conflict
+ */
+static
+SCIP_Bool conflictImplies(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_CONS*            cons1,              /**< first conflict constraint */
+   SCIP_CONS*            cons2               /**< second conflict constraint */
+   )
+{
+   SCIP_BOUNDTYPE* boundtypes1;
+   SCIP_BOUNDTYPE* boundtypes2;
+   SCIP_VAR** vars1;
+   SCIP_VAR** vars2;
+   SCIP_Real* bounds1;
+   SCIP_Real* bounds2;
+   int nliterals1;
+   int nliterals2;
+   int i;
+   int j;
+
+   if( !getConflictLiterals(set, cons1, &vars1, &boundtypes1, &bounds1, &nliterals1)
+      || !getConflictLiterals(set, cons2, &vars2, &boundtypes2, &bounds2, &nliterals2) )
+      return FALSE;
+
+   for( i = 0; i < nliterals1; ++i )
+   {
+      SCIP_BOUNDTYPE boundtype1 = (boundtypes1 == NULL ? SCIP_BOUNDTYPE_LOWER : boundtypes1[i]);
+      SCIP_Real bound1 = (bounds1 == NULL ? 1.0 : bounds1[i]);
+
+      for( j = 0; j < nliterals2; ++j )
+      {
+         SCIP_BOUNDTYPE boundtype2 = (boundtypes2 == NULL ? SCIP_BOUNDTYPE_LOWER : boundtypes2[j]);
+         SCIP_Real bound2 = (bounds2 == NULL ? 1.0 : bounds2[j]);
+
+         if( vars1[i] != vars2[j] || boundtype1 != boundtype2 )
+            continue;
+
+         if( boundtype1 == SCIP_BOUNDTYPE_LOWER ? SCIPsetIsGE(set, bound1, bound2) : SCIPsetIsLE(set, bound1, bound2) )
+            break;
+      }
+
+      if( j == nliterals2 )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** returns the primal bound up to which a conflict is valid */
+static
+SCIP_Real getConflictValidBound(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Real             primalbound         /**< primal bound the conflict depends on, or -infinity */
+   )
+{
+   return SCIPsetIsInfinity(set, REALABS(primalbound)) ? SCIPsetInfinity(set) : primalbound;
+}
+
 /* initializes the conflict store */
 static
 SCIP_RETCODE initConflictstore(
@@ -255,6 +494,8 @@ SCIP_RETCODE conflictstoreEnsureMem(
          newsize = MAX(newsize, num);
          SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->conflicts, newsize) );
          SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->confprimalbnds, newsize) );
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->confsignatures, newsize) );
+         SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &conflictstore->conflbds, newsize) );
       }
       else
       {
@@ -264,6 +505,10 @@ SCIP_RETCODE conflictstoreEnsureMem(
                newsize) );
          SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictstore->confprimalbnds, conflictstore->conflictsize, \
                newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictstore->confsignatures, conflictstore->conflictsize, \
+               newsize) );
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &conflictstore->conflbds, conflictstore->conflictsize, \
+               newsize) );
       }
 
 #ifndef NDEBUG
@@ -352,6 +597,8 @@ SCIP_RETCODE delPosConflict(
    {
       conflictstore->conflicts[pos] = conflictstore->conflicts[lastpos];
       conflictstore->confprimalbnds[pos] = conflictstore->confprimalbnds[lastpos];
+      conflictstore->confsignatures[pos] = conflictstore->confsignatures[lastpos];
+      conflictstore->conflbds[pos] = conflictstore->conflbds[lastpos];
    }
 
 #ifndef NDEBUG
@@ -608,6 +855,126 @@ SCIP_RETCODE cleanDeletedAndCheckedDualsolCons(
    return SCIP_OKAY;
 }
 
+/** sorts the conflicts such that the conflicts of the highest tier come first, ordered by decreasing age */
+static
+SCIP_RETCODE sortConflicts(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_CONS** conflicts;
+   SCIP_Real* primalbnds;
+   uint64_t* signatures;
+   int* lbds;
+   int* perm;
+   int nconflicts;
+   int i;
+
+   assert(conflictstore != NULL);
+
+   nconflicts = conflictstore->nconflicts;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &perm, nconflicts) );
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &conflicts, conflictstore->conflicts, nconflicts) );
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &primalbnds, conflictstore->confprimalbnds, nconflicts) );
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &signatures, conflictstore->confsignatures, nconflicts) );
+   SCIP_CALL( SCIPsetDuplicateBufferArray(set, &lbds, conflictstore->conflbds, nconflicts) );
+
+   for( i = 0; i < nconflicts; ++i )
+      perm[i] = i;
+
+   SCIPsortInd(perm, compareConflicts, (void*)conflictstore, nconflicts);
+
+   for( i = 0; i < nconflicts; ++i )
+   {
+      conflictstore->conflicts[i] = conflicts[perm[i]];
+      conflictstore->confprimalbnds[i] = primalbnds[perm[i]];
+      conflictstore->confsignatures[i] = signatures[perm[i]];
+      conflictstore->conflbds[i] = lbds[perm[i]];
+   }
+
+   SCIPsetFreeBufferArray(set, &lbds);
+   SCIPsetFreeBufferArray(set, &signatures);
+   SCIPsetFreeBufferArray(set, &primalbnds);
+   SCIPsetFreeBufferArray(set, &conflicts);
+   SCIPsetFreeBufferArray(set, &perm);
+
+   return SCIP_OKAY;
+}
+
+/** checks a new conflict for subsumption against the stored conflicts
+ *
+ *  Stored conflicts that are implied by the new conflict are removed from the problem if the new conflict is globally
+ *  valid and does not depend on a smaller primal bound. Conversely, the new conflict is redundant if it is implied by a
+ *  globally valid stored conflict. The bit signatures of the variables are used to skip most pairs of conflicts
+ *  without comparing their literals.
+ */
+static
+SCIP_RETCODE removeSubsumedConflicts(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic SCIP statistics */
+   SCIP_PROB*            transprob,          /**< transformed problem */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_REOPT*           reopt,              /**< reoptimization data */
+   SCIP_CONS*            cons,               /**< new conflict constraint */
+   uint64_t              signature,          /**< bit signature of the variables of the new conflict */
+   SCIP_Real             primalbound,        /**< primal bound the new conflict depends on (or -infinity) */
+   SCIP_Bool*            redundant           /**< pointer to store whether the new conflict is implied by a stored one */
+   )
+{
+   SCIP_Real validbound;
+   int i;
+
+   assert(conflictstore != NULL);
+   assert(redundant != NULL);
+
+   *redundant = FALSE;
+
+   if( signature == 0 )
+      return SCIP_OKAY;
+
+   validbound = getConflictValidBound(set, primalbound);
+
+   /* we traverse backwards, such that conflicts moved to the position of a removed one have already been checked */
+   for( i = conflictstore->nconflicts-1; i >= 0; --i )
+   {
+      SCIP_CONS* conflict;
+      uint64_t confsignature;
+      SCIP_Real confvalidbound;
+
+      confsignature = conflictstore->confsignatures[i];
+
+      if( confsignature == 0 || ((confsignature & ~signature) != 0 && (signature & ~confsignature) != 0) )
+         continue;
+
+      conflict = conflictstore->conflicts[i];
+
+      if( SCIPconsIsDeleted(conflict) )
+         continue;
+
+      confvalidbound = getConflictValidBound(set, conflictstore->confprimalbnds[i]);
+
+      /* the stored conflict implies the new one */
+      if( (confsignature & ~signature) == 0 && !SCIPconsIsLocal(conflict) && SCIPsetIsGE(set, confvalidbound, validbound)
+         && conflictImplies(set, conflict, cons) )
+      {
+         *redundant = TRUE;
+         break;
+      }
+
+      /* the new conflict implies the stored one */
+      if( (signature & ~confsignature) == 0 && !SCIPconsIsLocal(cons) && !SCIPconsIsChecked(conflict)
+         && SCIPsetIsGE(set, validbound, confvalidbound) && conflictImplies(set, cons, conflict) )
+      {
+         SCIP_CALL( delPosConflict(conflictstore, set, stat, transprob, blkmem, reopt, i, TRUE) );
+         ++conflictstore->nsubsumed;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** cleans up the storage */
 static
 SCIP_RETCODE conflictstoreCleanUpStorage(
@@ -648,10 +1015,10 @@ SCIP_RETCODE conflictstoreCleanUpStorage(
    /* resort the array regularly */
    if( conflictstore->ncleanups % CONFLICTSTORE_SORTFREQ == 0 )
    {
-      /* sort conflict */
-      SCIPsortPtrReal((void**)conflictstore->conflicts, conflictstore->confprimalbnds, compareConss, conflictstore->nconflicts);
-      assert(SCIPsetIsGE(set, SCIPconsGetAge(conflictstore->conflicts[0]),
-            SCIPconsGetAge(conflictstore->conflicts[conflictstore->nconflicts-1])));
+      /* sort conflicts by tier and age */
+      SCIP_CALL( sortConflicts(conflictstore, set) );
+      assert(getConflictTier(conflictstore->conflbds[0])
+         >= getConflictTier(conflictstore->conflbds[conflictstore->nconflicts-1]));
    }
    assert(conflictstore->nconflicts > 0);
 
@@ -663,22 +1030,29 @@ SCIP_RETCODE conflictstoreCleanUpStorage(
    else
    {
       SCIP_Real maxage;
+      int maxtier;
       int oldest_i;
       int i;
 
       assert(!SCIPconsIsDeleted(conflictstore->conflicts[0]));
 
       maxage = SCIPconsGetAge(conflictstore->conflicts[0]);
+      maxtier = getConflictTier(conflictstore->conflbds[0]);
       oldest_i = 0;
 
-      /* check the first 10% of conflicts and find the oldest */
+      /* check the first 10% of conflicts and find the oldest of the highest tier */
       for( i = 1; i < 0.1 * conflictstore->nconflicts; i++ )
       {
+         int tier;
+
          assert(!SCIPconsIsDeleted(conflictstore->conflicts[i]));
 
-         if( SCIPconsGetAge(conflictstore->conflicts[i]) > maxage )
+         tier = getConflictTier(conflictstore->conflbds[i]);
+
+         if( tier > maxtier || (tier == maxtier && SCIPconsGetAge(conflictstore->conflicts[i]) > maxage) )
          {
             maxage = SCIPconsGetAge(conflictstore->conflicts[i]);
+            maxtier = tier;
             oldest_i = i;
          }
       }
@@ -699,8 +1073,9 @@ SCIP_RETCODE conflictstoreCleanUpStorage(
    /* increase the number of clean ups */
    ++conflictstore->ncleanups;
 
-   SCIPsetDebugMsg(set, "clean-up #%lld: removed %d/%d conflicts, %d depending on cutoff bound\n",
-         conflictstore->ncleanups, ndelconfs, conflictstore->nconflicts+ndelconfs, conflictstore->ncbconflicts);
+   SCIPsetDebugMsg(set, "clean-up #%lld: removed %d/%d conflicts, %d depending on cutoff bound, %lld subsumed so far\n",
+         conflictstore->ncleanups, ndelconfs, conflictstore->nconflicts+ndelconfs, conflictstore->ncbconflicts,
+         conflictstore->nsubsumed);
 
    return SCIP_OKAY; /*lint !e438*/
 }
@@ -753,6 +1128,8 @@ SCIP_RETCODE SCIPconflictstoreCreate(
 
    (*conflictstore)->conflicts = NULL;
    (*conflictstore)->confprimalbnds = NULL;
+   (*conflictstore)->confsignatures = NULL;
+   (*conflictstore)->conflbds = NULL;
    (*conflictstore)->dualprimalbnds = NULL;
    (*conflictstore)->scalefactors = NULL;
    (*conflictstore)->updateside = NULL;
@@ -763,6 +1140,7 @@ SCIP_RETCODE SCIPconflictstoreCreate(
    (*conflictstore)->origconfs = NULL;
    (*conflictstore)->nnzdualrays = 0;
    (*conflictstore)->nnzdualsols = 0;
+   (*conflictstore)->nsubsumed = 0;
    (*conflictstore)->conflictsize = 0;
    (*conflictstore)->origconflictsize = 0;
    (*conflictstore)->nconflicts = 0;
@@ -809,6 +1187,8 @@ SCIP_RETCODE SCIPconflictstoreFree(
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->origconfs, (*conflictstore)->origconflictsize);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->conflicts, (*conflictstore)->conflictsize);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->confprimalbnds, (*conflictstore)->conflictsize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->confsignatures, (*conflictstore)->conflictsize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->conflbds, (*conflictstore)->conflictsize);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->dualrayconfs, CONFLICTSTORE_DUALRAYSIZE);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->drayrelaxonly, CONFLICTSTORE_DUALRAYSIZE);
    BMSfreeBlockMemoryArrayNull(blkmem, &(*conflictstore)->dualsolconfs, CONFLICTSTORE_DUALSOLSIZE);
@@ -1156,7 +1536,10 @@ SCIP_RETCODE SCIPconflictstoreAddConflict(
    )
 {
    SCIP_Longint curnodenum;
+   SCIP_Bool redundant;
+   uint64_t signature;
    int nconflicts;
+   int lbd;
 
    assert(conflictstore != NULL);
    assert(blkmem != NULL);
@@ -1205,6 +1588,24 @@ SCIP_RETCODE SCIPconflictstoreAddConflict(
    assert(tree != NULL);
    curnodenum = (SCIPtreeGetFocusNode(tree) == NULL ? -1 : SCIPnodeGetNumber(SCIPtreeGetFocusNode(tree)));
 
+   /* remove the stored conflicts implied by the new one, or the new one if it is implied by a stored conflict */
+   signature = calcConflictSignature(set, cons);
+   SCIP_CALL( removeSubsumedConflicts(conflictstore, set, stat, transprob, blkmem, reopt, cons, signature, primalbound,
+         &redundant) );
+
+   if( redundant )
+   {
+      SCIPsetDebugMsg(set, "conflict <%s> is implied by a stored conflict\n", SCIPconsGetName(cons));
+
+      SCIP_CALL( SCIPconsDelete(cons, blkmem, set, stat, transprob, reopt) );
+      ++conflictstore->nsubsumed;
+      ++conflictstore->nconflictsfound;
+
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( calcConflictLbd(set, cons, &lbd) );
+
    /* clean up the storage if we are at a new node or the storage is full */
    if( conflictstore->lastnodenum != curnodenum || conflictstore->nconflicts == conflictstore->conflictsize )
    {
@@ -1217,6 +1618,8 @@ SCIP_RETCODE SCIPconflictstoreAddConflict(
    SCIPconsCapture(cons);
    conflictstore->conflicts[conflictstore->nconflicts] = cons;
    conflictstore->confprimalbnds[conflictstore->nconflicts] = primalbound;
+   conflictstore->confsignatures[conflictstore->nconflicts] = signature;
+   conflictstore->conflbds[conflictstore->nconflicts] = lbd;
    conflictstore->ncbconflicts += (SCIPsetIsInfinity(set, REALABS(primalbound)) ? 0 : 1);
 
    ++conflictstore->nconflicts;
@@ -13408,6 +13408,46 @@ SCIP_DECL_CONSGETSIGNEDPERMSYMGRAPH(consGetSignedPermsymGraphKnapsack)
  * Event handler
  */
 
+/** returns whether a fixing of an item can lead to a deduction in propagateCons()
+ *
+ *  Similar to a watched literal scheme, this filters the bound change events that mark the constraint for propagation:
+ *  without negated cliques, fixings to zero never lead to deductions, and fixings to one only if the remaining capacity
+ *  is smaller than the largest weight of an item that is not fixed to one.
+ */
+static
+SCIP_Bool isPropagationTriggered(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< knapsack constraint */
+   SCIP_CONSDATA*        consdata,           /**< constraint data */
+   SCIP_Bool             fixedtoone          /**< was an item fixed to one (or to zero)? */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_Longint maxweight;
+
+   conshdlrdata = SCIPconshdlrGetData(SCIPconsGetHdlr(cons));
+   assert(conshdlrdata != NULL);
+
+   /* the negated clique propagation depends on more than the remaining capacity; it is only skipped in propagateCons()
+    * if the negated clique partition is valid, up to date, and trivial (see calcCliquepartition())
+    */
+   if( conshdlrdata->negatedclique && consdata->merged && (!consdata->negcliquepartitioned
+         || consdata->nnegcliques < consdata->nvars
+         || (conshdlrdata->updatecliquepartitions && consdata->nnegcliques > 1
+            && SCIPgetNCliques(scip) >= (int)(conshdlrdata->clqpartupdatefac * consdata->ncliqueslastnegpart))) )
+      return TRUE;
+
+   if( !fixedtoone )
+      return FALSE;
+
+   /* upper bound on the largest weight of an item that is not fixed to one */
+   maxweight = consdata->weightsum - consdata->onesweightsum;
+   if( consdata->sorted && consdata->nvars > 0 )
+      maxweight = MIN(maxweight, consdata->weights[0]);
+
+   return consdata->onesweightsum + maxweight > consdata->capacity;
+}
+
 /** execution method of bound change event handler */
 static
 SCIP_DECL_EVENTEXEC(eventExecKnapsack)
@@ -13425,14 +13465,20 @@ SCIP_DECL_EVENTEXEC(eventExecKnapsack)
    case SCIP_EVENTTYPE_LBTIGHTENED:
       consdata->onesweightsum += eventdata->weight;
       consdata->presolvedtiming = 0;
-      SCIP_CALL( SCIPmarkConsPropagate(scip, eventdata->cons) );
+      if( isPropagationTriggered(scip, eventdata->cons, consdata, TRUE) )
+      {
+         SCIP_CALL( SCIPmarkConsPropagate(scip, eventdata->cons) );
+      }
       break;
    case SCIP_EVENTTYPE_LBRELAXED:
       consdata->onesweightsum -= eventdata->weight;
       break;
    case SCIP_EVENTTYPE_UBTIGHTENED:
       consdata->presolvedtiming = 0;
-      SCIP_CALL( SCIPmarkConsPropagate(scip, eventdata->cons) );
+      if( isPropagationTriggered(scip, eventdata->cons, consdata, FALSE) )
+      {
+         SCIP_CALL( SCIPmarkConsPropagate(scip, eventdata->cons) );
+      }
       break;
    case SCIP_EVENTTYPE_VARFIXED:  /* the variable should be removed from the constraint in presolving */
       if( !consdata->existmultaggr )
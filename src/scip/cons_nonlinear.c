@@ -320,6 +320,7 @@ struct SCIP_ConshdlrData
    SCIP_Real             branchmixfractional; /**< minimal average pseudo cost count for discrete variables at which to start considering spatial branching before branching on fractional integer variables */
    char                  linearizeheursol;   /**< whether tight linearizations of nonlinear constraints should be added to cutpool when some heuristics finds a new solution ('o'ff, on new 'i'ncumbents, on 'e'very solution) */
    SCIP_Bool             assumeconvex;       /**< whether to assume that any constraint is convex */
+   SCIP_Bool             compileexprs;       /**< whether to compile the expressions of constraints into evaluation tapes when solving */
 
    /* statistics */
    SCIP_Longint          nweaksepa;          /**< number of times we used "weak" cuts for enforcement */
@@ -11236,6 +11237,15 @@ SCIP_DECL_CONSINITSOL(consInitsolNonlinear)
 
    SCIP_CALL( initSolve(scip, conshdlr, conss, nconss) );
 
+   /* compile expressions, so that they are evaluated without iterating over them */
+   if( conshdlrdata->compileexprs )
+   {
+      for( i = 0; i < nconss; ++i )
+      {
+         SCIP_CALL( SCIPcompileExpr(scip, SCIPconsGetData(conss[i])->expr) );
+      }
+   }
+
    /* check that branching/lpgainnormalize is set to a known value if pseudo-costs are used in branching */
    if( conshdlrdata->branchpscostweight > 0.0 )
    {
@@ -11257,6 +11267,11 @@ static
 SCIP_DECL_CONSEXITSOL(consExitsolNonlinear)
 {  /*lint --e{715}*/
    SCIP_CONSHDLRDATA* conshdlrdata;
+   int i;
+
+   /* free evaluation tapes */
+   for( i = 0; i < nconss; ++i )
+      SCIPfreeExprTape(scip, SCIPconsGetData(conss[i])->expr);
 
    SCIP_CALL( deinitSolve(scip, conshdlr, conss, nconss) );
 
@@ -12551,6 +12566,10 @@ SCIP_RETCODE SCIPincludeConshdlrNonlinear(
          "whether to assume that any constraint is convex",
          &conshdlrdata->assumeconvex, FALSE, FALSE, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/compileexprs",
+         "whether to compile the expressions of constraints into evaluation tapes when solving",
+         &conshdlrdata->compileexprs, TRUE, TRUE, NULL, NULL) );
+
    /* include handler for bound change events */
    SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &conshdlrdata->eventhdlr, CONSHDLR_NAME "_boundchange",
          "signals a bound change to a nonlinear constraint", processVarEvent, NULL) );
@@ -14254,6 +14273,39 @@ SCIP_RETCODE SCIPgetRelViolationNonlinear(
    return SCIP_OKAY;
 }
 
+/** evaluates the expressions of nonlinear constraints at a block of points
+ *
+ * The values of the variables are given in structure-of-arrays layout as for SCIPevalExprBatch().
+ * The value of the expression of the c-th constraint at point p is stored in activities[c * npoints + p],
+ * with SCIP_INVALID for points where an evaluation error occurred.
+ */
+SCIP_RETCODE SCIPevalConssNonlinearBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< nonlinear constraints */
+   int                   nconss,             /**< number of constraints */
+   int                   npoints,            /**< number of points */
+   SCIP_HASHMAP*         varidxs,            /**< map from variables to indices in varvals, or NULL to use problem indices */
+   SCIP_Real*            varvals,            /**< values of variables at the points */
+   SCIP_Real*            activities          /**< buffer to store the values of the expressions at the points (size nconss * npoints) */
+   )
+{
+   int c;
+
+   assert(conss != NULL || nconss == 0);
+   assert(activities != NULL || nconss == 0 || npoints == 0);
+
+   for( c = 0; c < nconss; ++c )
+   {
+      assert(conss[c] != NULL);
+      assert(strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), CONSHDLR_NAME) == 0);
+
+      SCIP_CALL( SCIPevalExprBatch(scip, SCIPgetExprNonlinear(conss[c]), npoints, varidxs, varvals,
+            &activities[(size_t)c * npoints]) );  /*lint !e613*/
+   }
+
+   return SCIP_OKAY;
+}
+
 /** returns a variable that appears linearly that may be decreased without making any other constraint infeasible */
 void SCIPgetLinvarMayDecreaseNonlinear(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -686,6 +686,23 @@ SCIP_RETCODE SCIPgetRelViolationNonlinear(
    SCIP_Real*            viol                /**< buffer to store computed violation */
    );
 
+/** evaluates the expressions of nonlinear constraints at a block of points
+ *
+ * The values of the variables are given in structure-of-arrays layout as for SCIPevalExprBatch().
+ * The value of the expression of the c-th constraint at point p is stored in activities[c * npoints + p],
+ * with SCIP_INVALID for points where an evaluation error occurred.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPevalConssNonlinearBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< nonlinear constraints */
+   int                   nconss,             /**< number of constraints */
+   int                   npoints,            /**< number of points */
+   SCIP_HASHMAP*         varidxs,            /**< map from variables to indices in varvals, or NULL to use problem indices */
+   SCIP_Real*            varvals,            /**< values of variables at the points */
+   SCIP_Real*            activities          /**< buffer to store the values of the expressions at the points (size nconss * npoints) */
+   );
+
 /** returns a variable that appears linearly that may be decreased without making any other constraint infeasible */
 SCIP_EXPORT
 void SCIPgetLinvarMayDecreaseNonlinear(
@@ -9105,9 +9105,14 @@ SCIP_DECL_EVENTEXEC(eventExecSetppc)
    assert(0 <= consdata->nfixedzeros && consdata->nfixedzeros <= consdata->nvars);
    assert(0 <= consdata->nfixedones && consdata->nfixedones <= consdata->nvars);
 
+   /* similar to a watched literal scheme, only fixings that can lead to a deduction mark the constraint for
+    * propagation: every fixing to one, and a fixing to zero that leaves at most one unfixed variable; further fixings to
+    * zero after a fixing to one do not lead to additional deductions, since the constraint was marked by the latter
+    */
    if( eventtype & SCIP_EVENTTYPE_BOUNDTIGHTENED )
    {
-      if( consdata->nfixedones >= 1 || consdata->nfixedzeros >= consdata->nvars - 1 )
+      if( (eventtype == SCIP_EVENTTYPE_LBTIGHTENED && consdata->nfixedones >= 1)
+         || consdata->nfixedzeros >= consdata->nvars - 1 )
       {
          consdata->presolpropagated = FALSE;
          SCIP_CALL( SCIPmarkConsPropagate(scip, cons) );
@@ -40,6 +40,7 @@
 
 #include "scip/def.h"
 #include "blockmemshell/memory.h"
+#include "scip/conflict_graphanalysis.h"
 #include "scip/set.h"
 #include "scip/lp.h"
 #include "scip/var.h"
@@ -1777,8 +1778,8 @@ SCIP_RETCODE SCIPdebugCheckConflictFrontier(
    SCIP_BDCHGINFO**      bdchginfos,         /**< bound change informations of the conflict set */
    SCIP_Real*            relaxedbds,         /**< array with relaxed bounds which are efficient to create a valid conflict */
    int                   nbdchginfos,        /**< number of bound changes in the conflict set */
-   SCIP_PQUEUE*          bdchgqueue,         /**< unprocessed conflict bound changes */
-   SCIP_PQUEUE*          forcedbdchgqueue    /**< unprocessed conflict bound changes that must be resolved */
+   SCIP_BDCHGQUEUE*      bdchgqueue,         /**< unprocessed conflict bound changes */
+   SCIP_BDCHGQUEUE*      forcedbdchgqueue    /**< unprocessed conflict bound changes that must be resolved */
    )
 {
    SCIP_BDCHGINFO** bdchgqueued;
@@ -1814,16 +1815,16 @@ SCIP_RETCODE SCIPdebugCheckConflictFrontier(
       return SCIP_OKAY;
 
    /* get the elements of the bound change queue */
-   bdchgqueued = (SCIP_BDCHGINFO**)SCIPpqueueElems(bdchgqueue);
-   nbdchgqueued = SCIPpqueueNElems(bdchgqueue);
+   bdchgqueued = SCIPbdchgqueueElems(bdchgqueue);
+   nbdchgqueued = SCIPbdchgqueueNElems(bdchgqueue);
 
    /* check, whether one literals is TRUE in the debugging solution */
    if( debugCheckBdchginfos(set, bdchgqueued, NULL, nbdchgqueued) )
       return SCIP_OKAY;
 
    /* get the elements of the bound change queue */
-   forcedbdchgqueued = (SCIP_BDCHGINFO**)SCIPpqueueElems(forcedbdchgqueue);
-   nforcedbdchgqueued = SCIPpqueueNElems(forcedbdchgqueue);
+   forcedbdchgqueued = SCIPbdchgqueueElems(forcedbdchgqueue);
+   nforcedbdchgqueued = SCIPbdchgqueueNElems(forcedbdchgqueue);
 
    /* check, whether one literals is TRUE in the debugging solution */
    if( debugCheckBdchginfos(set, forcedbdchgqueued, NULL, nforcedbdchgqueued) )
@@ -42,6 +42,7 @@
 
 #ifdef WITH_DEBUG_SOLUTION
 #include "blockmemshell/memory.h"
+#include "scip/type_conflict.h"
 #include "scip/type_cons.h"
 #include "scip/type_lp.h"
 #include "scip/type_misc.h"
@@ -204,8 +205,8 @@ SCIP_RETCODE SCIPdebugCheckConflictFrontier(
    SCIP_BDCHGINFO**      bdchginfos,         /**< bound change informations of the conflict set */
    SCIP_Real*            relaxedbds,         /**< array with relaxed bounds which are efficient to create a valid conflict */
    int                   nbdchginfos,        /**< number of bound changes in the conflict set */
-   SCIP_PQUEUE*          bdchgqueue,         /**< unprocessed conflict bound changes */
-   SCIP_PQUEUE*          forcedbdchgqueue    /**< unprocessed conflict bound changes that must be resolved */
+   SCIP_BDCHGQUEUE*      bdchgqueue,         /**< unprocessed conflict bound changes */
+   SCIP_BDCHGQUEUE*      forcedbdchgqueue    /**< unprocessed conflict bound changes that must be resolved */
    );
 
 /** creates the debugging propagator and includes it in SCIP */
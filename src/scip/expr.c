@@ -69,6 +69,25 @@ struct SCIP_ExprPrintData
  * Local methods
  */
 
+/** frees an evaluation tape */
+static
+void tapeFree(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPRTAPE**       tape                /**< pointer to the tape to free */
+   )
+{
+   assert(tape != NULL);
+   assert(*tape != NULL);
+
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->adjoints, (*tape)->nops);
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->vals, (*tape)->nops);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*tape)->childpos, (*tape)->childbegin[(*tape)->nops]);
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->childbegin, (*tape)->nops + 1);
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->ops, (*tape)->nops);
+   BMSfreeBlockMemoryArray(blkmem, &(*tape)->exprs, (*tape)->nops);
+   BMSfreeBlockMemory(blkmem, tape);
+}
+
 /** frees an expression */
 static
 SCIP_RETCODE freeExpr(
@@ -82,6 +101,10 @@ SCIP_RETCODE freeExpr(
    assert((*expr)->quaddata == NULL);
    assert((*expr)->ownerdata == NULL);
 
+   /* free evaluation tape, if any */
+   if( (*expr)->tape != NULL )
+      tapeFree(blkmem, &(*expr)->tape);
+
    /* free children array, if any */
    BMSfreeBlockMemoryArrayNull(blkmem, &(*expr)->children, (*expr)->childrensize);
 
@@ -180,6 +203,614 @@ SCIP_RETCODE quadDetectGetQuadexprterm(
 }
 
 
+/*
+ * evaluation tape
+ */
+
+/** creates the evaluation tape of an expression
+ *
+ * The distinct subexpressions are stored in the order in which a depth-first search leaves them, so children are
+ * stored before their parents and the expression itself is stored last.
+ */
+static
+SCIP_RETCODE tapeCreate(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            rootexpr,           /**< expression */
+   SCIP_EXPRTAPE**       tape                /**< pointer to store the tape */
+   )
+{
+   SCIP_EXPRITER* it;
+   SCIP_HASHMAP* exprpos;
+   SCIP_EXPRHDLR* exphdlr;
+   SCIP_EXPRHDLR* loghdlr;
+   SCIP_EXPR* expr;
+   int nchildpos;
+   int nops;
+   int c;
+
+   assert(tape != NULL);
+
+   SCIP_CALL( SCIPexpriterCreate(stat, blkmem, &it) );
+   SCIP_CALL( SCIPexpriterInit(it, rootexpr, SCIP_EXPRITER_DFS, FALSE) );
+   SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_LEAVEEXPR);
+
+   /* count distinct subexpressions and their children */
+   nops = 0;
+   nchildpos = 0;
+   for( expr = SCIPexpriterGetCurrent(it); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+   {
+      ++nops;
+      nchildpos += expr->nchildren;
+   }
+   assert(nops >= 1);
+
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, tape) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->exprs, nops) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->ops, nops) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->childbegin, nops + 1) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->vals, nops) );
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->adjoints, nops) );
+   (*tape)->childpos = NULL;
+   if( nchildpos > 0 )
+   {
+      SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, &(*tape)->childpos, nchildpos) );
+   }
+   (*tape)->nops = nops;
+   (*tape)->structtag = stat->exprlaststructtag;
+
+   exphdlr = SCIPsetFindExprhdlr(set, "exp");
+   loghdlr = SCIPsetFindExprhdlr(set, "log");
+
+   SCIP_CALL( SCIPhashmapCreate(&exprpos, blkmem, nops) );
+
+   /* store subexpressions in the order in which they are left, which is a topological order */
+   SCIP_CALL( SCIPexpriterInit(it, rootexpr, SCIP_EXPRITER_DFS, FALSE) );
+   SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_LEAVEEXPR);
+
+   nops = 0;
+   nchildpos = 0;
+   for( expr = SCIPexpriterGetCurrent(it); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+   {
+      (*tape)->exprs[nops] = expr;
+      (*tape)->childbegin[nops] = nchildpos;
+
+      if( expr->exprhdlr == set->exprhdlrvar )
+         (*tape)->ops[nops] = SCIP_EXPRTAPEOP_VAR;
+      else if( expr->exprhdlr == set->exprhdlrval )
+         (*tape)->ops[nops] = SCIP_EXPRTAPEOP_VALUE;
+      else if( expr->exprhdlr == set->exprhdlrsum )
+         (*tape)->ops[nops] = SCIP_EXPRTAPEOP_SUM;
+      else if( expr->exprhdlr == set->exprhdlrproduct )
+         (*tape)->ops[nops] = SCIP_EXPRTAPEOP_PRODUCT;
+      else if( expr->exprhdlr == exphdlr && expr->nchildren == 1 )
+         (*tape)->ops[nops] = SCIP_EXPRTAPEOP_EXP;
+      else if( expr->exprhdlr == loghdlr && expr->nchildren == 1 )
+         (*tape)->ops[nops] = SCIP_EXPRTAPEOP_LOG;
+      else
+         (*tape)->ops[nops] = SCIP_EXPRTAPEOP_OTHER;
+
+      /* children have been left before, so their positions are known */
+      for( c = 0; c < expr->nchildren; ++c )
+      {
+         assert(SCIPhashmapExists(exprpos, (void*)expr->children[c]));
+         (*tape)->childpos[nchildpos++] = SCIPhashmapGetImageInt(exprpos, (void*)expr->children[c]);
+      }
+
+      SCIP_CALL( SCIPhashmapInsertInt(exprpos, (void*)expr, nops) );
+      ++nops;
+   }
+   assert(nops == (*tape)->nops);
+   assert((*tape)->exprs[nops-1] == rootexpr);
+
+   (*tape)->childbegin[nops] = nchildpos;
+
+   SCIPhashmapFree(&exprpos);
+   SCIPexpriterFree(&it);
+
+   return SCIP_OKAY;
+}
+
+/** returns the evaluation tape of an expression, recompiling it if the structure of any expression changed since
+ *  compilation, or NULL if the expression has not been compiled
+ */
+static
+SCIP_RETCODE tapeGet(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            rootexpr,           /**< expression */
+   SCIP_EXPRTAPE**       tape                /**< buffer to store the tape */
+   )
+{
+   assert(rootexpr != NULL);
+   assert(tape != NULL);
+
+   if( rootexpr->tape != NULL && rootexpr->tape->structtag != stat->exprlaststructtag )
+   {
+      tapeFree(blkmem, &rootexpr->tape);
+      SCIP_CALL( tapeCreate(set, stat, blkmem, rootexpr, &rootexpr->tape) );
+   }
+
+   *tape = rootexpr->tape;
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the expression of a tape in a point
+ *
+ * The root of the tape has to be set up as in SCIPexprEval().
+ * Values of all subexpressions are stored in the subexpressions, too.
+ */
+static
+SCIP_RETCODE tapeEval(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPRTAPE*        tape,               /**< evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
+   )
+{
+   SCIP_Real* vals;
+   int i;
+
+   assert(tape != NULL);
+
+   vals = tape->vals;
+
+   for( i = 0; i < tape->nops; ++i )
+   {
+      SCIP_EXPR* expr = tape->exprs[i];
+      int* childpos = &tape->childpos[tape->childbegin[i]];  /*lint !e679*/
+      SCIP_Real val;
+      int c;
+
+      /* reuse value of a subexpression that has been evaluated for this solution already */
+      if( soltag != 0 && expr->evaltag == soltag && i < tape->nops - 1 )
+      {
+         if( expr->evalvalue == SCIP_INVALID )
+            return SCIP_OKAY;
+
+         vals[i] = expr->evalvalue;
+         continue;
+      }
+
+      switch( tape->ops[i] )
+      {
+         case SCIP_EXPRTAPEOP_VAR :
+            if( sol != NULL )
+               val = SCIPsolGetVal(sol, set, stat, SCIPgetVarExprVar(expr));
+            else
+            {
+               SCIP_CALL( SCIPexprhdlrEvalExpr(expr->exprhdlr, set, NULL, expr, &val, NULL, sol) );
+            }
+            break;
+
+         case SCIP_EXPRTAPEOP_VALUE :
+            val = SCIPgetValueExprValue(expr);
+            break;
+
+         case SCIP_EXPRTAPEOP_SUM :
+         {
+            SCIP_Real* coefs = SCIPgetCoefsExprSum(expr);
+
+            val = SCIPgetConstantExprSum(expr);
+            for( c = 0; c < expr->nchildren; ++c )
+               val += coefs[c] * vals[childpos[c]];
+            break;
+         }
+
+         case SCIP_EXPRTAPEOP_PRODUCT :
+            val = SCIPgetCoefExprProduct(expr);
+            for( c = 0; c < expr->nchildren && val != 0.0; ++c )
+               val *= vals[childpos[c]];
+            break;
+
+         case SCIP_EXPRTAPEOP_EXP :
+            val = exp(vals[childpos[0]]);
+            break;
+
+         case SCIP_EXPRTAPEOP_LOG :
+            val = (vals[childpos[0]] > 0.0 ? log(vals[childpos[0]]) : SCIP_INVALID);
+            break;
+
+         case SCIP_EXPRTAPEOP_OTHER :
+         default :
+            SCIP_CALL( SCIPexprhdlrEvalExpr(expr->exprhdlr, set, NULL, expr, &val, NULL, sol) );
+            break;
+      }
+
+      /* catch evaluation errors, e.g., overflows */
+      if( !SCIPisFinite(val) )
+         val = SCIP_INVALID;
+
+      vals[i] = val;
+      expr->evalvalue = val;
+      expr->evaltag = soltag;
+
+      if( val == SCIP_INVALID )
+         return SCIP_OKAY;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the expression of a tape at a block of points
+ *
+ * The values of all subexpressions at all points are stored in structure-of-arrays layout, such that each operation
+ * is a loop over the points. Expressions that are not evaluated inline are evaluated by the batched evaluation
+ * callback of their handler, if implemented, and point by point otherwise.
+ */
+static
+SCIP_RETCODE tapeEvalBatch(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_EXPRTAPE*        tape,               /**< evaluation tape */
+   int                   npoints,            /**< number of points */
+   SCIP_HASHMAP*         varidxs,            /**< map from variables to indices in varvals, or NULL to use problem indices */
+   SCIP_Real*            varvals,            /**< values of variables, varvals[i * npoints + p] is the value of the variable with index i at point p */
+   SCIP_Real*            vals                /**< buffer to store the values of the expression at the points */
+   )
+{
+   SCIP_Real** childvals;
+   SCIP_Real* childrenvals;
+   SCIP_Real* batchvals;
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   int maxnchildren;
+   int i;
+   int p;
+   int c;
+
+   assert(tape != NULL);
+   assert(npoints > 0);
+   assert(varvals != NULL);
+   assert(vals != NULL);
+
+   maxnchildren = 1;
+   for( i = 0; i < tape->nops; ++i )
+      maxnchildren = MAX(maxnchildren, tape->exprs[i]->nchildren);
+
+   /* values of the expression itself are stored in vals directly */
+   SCIP_ALLOC( BMSallocBufferMemoryArray(bufmem, &childvals, maxnchildren) );
+   SCIP_ALLOC( BMSallocBufferMemoryArray(bufmem, &childrenvals, maxnchildren) );
+   SCIP_ALLOC( BMSallocBufferMemoryArray(bufmem, &batchvals, (size_t)(tape->nops - 1) * npoints + 1) );
+
+   for( i = 0; i < tape->nops; ++i )
+   {
+      SCIP_EXPR* expr = tape->exprs[i];
+      int* childpos = &tape->childpos[tape->childbegin[i]];  /*lint !e679*/
+      SCIP_Real* out;
+
+      out = (i == tape->nops - 1) ? vals : &batchvals[(size_t)i * npoints];
+
+      for( c = 0; c < expr->nchildren; ++c )
+         childvals[c] = &batchvals[(size_t)childpos[c] * npoints];
+
+      switch( tape->ops[i] )
+      {
+         case SCIP_EXPRTAPEOP_VAR :
+         {
+            SCIP_VAR* var = SCIPgetVarExprVar(expr);
+            int idx;
+
+            if( varidxs != NULL )
+               idx = SCIPhashmapExists(varidxs, (void*)var) ? SCIPhashmapGetImageInt(varidxs, (void*)var) : -1;
+            else
+               idx = SCIPvarGetProbindex(var);
+
+            if( idx < 0 )
+            {
+               SCIPerrorMessage("no values given for variable <%s> in batched expression evaluation\n", SCIPvarGetName(var));
+               retcode = SCIP_INVALIDDATA;
+               goto TERMINATE;
+            }
+
+            BMScopyMemoryArray(out, &varvals[(size_t)idx * npoints], npoints);
+            continue;
+         }
+
+         case SCIP_EXPRTAPEOP_VALUE :
+         {
+            SCIP_Real value = SCIPgetValueExprValue(expr);
+
+            for( p = 0; p < npoints; ++p )
+               out[p] = value;
+            continue;
+         }
+
+         case SCIP_EXPRTAPEOP_SUM :
+         {
+            SCIP_Real* coefs = SCIPgetCoefsExprSum(expr);
+            SCIP_Real constant = SCIPgetConstantExprSum(expr);
+
+            for( p = 0; p < npoints; ++p )
+               out[p] = constant;
+            for( c = 0; c < expr->nchildren; ++c )
+            {
+               SCIP_Real coef = coefs[c];
+               SCIP_Real* cv = childvals[c];
+
+               for( p = 0; p < npoints; ++p )
+                  out[p] += coef * cv[p];
+            }
+            break;
+         }
+
+         case SCIP_EXPRTAPEOP_PRODUCT :
+         {
+            SCIP_Real coef = SCIPgetCoefExprProduct(expr);
+
+            for( p = 0; p < npoints; ++p )
+               out[p] = coef;
+            for( c = 0; c < expr->nchildren; ++c )
+            {
+               SCIP_Real* cv = childvals[c];
+
+               for( p = 0; p < npoints; ++p )
+                  out[p] *= cv[p];
+            }
+            break;
+         }
+
+         case SCIP_EXPRTAPEOP_EXP :
+         case SCIP_EXPRTAPEOP_LOG :
+         case SCIP_EXPRTAPEOP_OTHER :
+         default :
+         {
+            if( expr->exprhdlr->evalbatch != NULL )
+            {
+               SCIP_CALL_TERMINATE( retcode, expr->exprhdlr->evalbatch(set->scip, expr, childvals, out, npoints), TERMINATE );
+               break;
+            }
+
+            /* evaluate point by point with the values of the children given explicitly */
+            for( p = 0; p < npoints; ++p )
+            {
+               for( c = 0; c < expr->nchildren; ++c )
+               {
+                  childrenvals[c] = childvals[c][p];
+                  if( childrenvals[c] == SCIP_INVALID )
+                     break;
+               }
+
+               if( c < expr->nchildren )
+                  out[p] = SCIP_INVALID;
+               else
+               {
+                  SCIP_CALL_TERMINATE( retcode, SCIPexprhdlrEvalExpr(expr->exprhdlr, set, bufmem, expr, &out[p],
+                        childrenvals, NULL), TERMINATE );
+               }
+            }
+            break;
+         }
+      }
+
+      /* a point is invalid if any child is invalid at that point or an evaluation error occurred */
+      for( c = 0; c < expr->nchildren; ++c )
+      {
+         SCIP_Real* cv = childvals[c];
+
+         for( p = 0; p < npoints; ++p )
+            out[p] = (cv[p] == SCIP_INVALID) ? SCIP_INVALID : out[p];
+      }
+      for( p = 0; p < npoints; ++p )
+      {
+         if( !SCIPisFinite(out[p]) )
+            out[p] = SCIP_INVALID;
+      }
+   }
+
+TERMINATE:
+   BMSfreeBufferMemoryArray(bufmem, &batchvals);
+   BMSfreeBufferMemoryArray(bufmem, &childrenvals);
+   BMSfreeBufferMemoryArray(bufmem, &childvals);
+
+   return retcode;
+}
+
+/** computes the gradient of the expression of a tape by a backward sweep over the tape
+ *
+ * The expression has to be evaluated on the tape before.
+ */
+static
+SCIP_RETCODE tapeEvalGradient(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPRTAPE*        tape,               /**< evaluation tape */
+   SCIP_EXPR*            rootexpr            /**< expression of tape */
+   )
+{
+   SCIP_Real* adjoints;
+   SCIP_Real* vals;
+   SCIP_Longint difftag;
+   int i;
+
+   assert(tape != NULL);
+   assert(tape->exprs[tape->nops-1] == rootexpr);
+
+   adjoints = tape->adjoints;
+   vals = tape->vals;
+   difftag = ++(stat->exprlastdifftag);
+
+   BMSclearMemoryArray(adjoints, tape->nops - 1);
+   adjoints[tape->nops - 1] = 1.0;
+
+   for( i = tape->nops - 1; i >= 0; --i )
+   {
+      SCIP_EXPR* expr = tape->exprs[i];
+      int* childpos = &tape->childpos[tape->childbegin[i]];  /*lint !e679*/
+      int c;
+
+      /* all parents of the expression have been processed, so its partial derivative is complete */
+      expr->derivative = adjoints[i];
+      expr->difftag = difftag;
+
+      for( c = 0; c < expr->nchildren; ++c )
+      {
+         SCIP_Real derivative;
+         int pos = childpos[c];
+
+         if( tape->ops[pos] == SCIP_EXPRTAPEOP_VALUE )
+            continue;
+
+         switch( tape->ops[i] )
+         {
+            case SCIP_EXPRTAPEOP_SUM :
+               derivative = SCIPgetCoefsExprSum(expr)[c];
+               break;
+
+            case SCIP_EXPRTAPEOP_PRODUCT :
+               if( !SCIPsetIsZero(set, vals[pos]) )
+                  derivative = vals[i] / vals[pos];
+               else
+               {
+                  int j;
+
+                  derivative = SCIPgetCoefExprProduct(expr);
+                  for( j = 0; j < expr->nchildren && derivative != 0.0; ++j )
+                  {
+                     if( j != c )
+                        derivative *= vals[childpos[j]];
+                  }
+               }
+               break;
+
+            case SCIP_EXPRTAPEOP_EXP :
+               derivative = vals[i];
+               break;
+
+            case SCIP_EXPRTAPEOP_LOG :
+               derivative = 1.0 / vals[pos];
+               break;
+
+            case SCIP_EXPRTAPEOP_VAR :
+            case SCIP_EXPRTAPEOP_VALUE :
+            case SCIP_EXPRTAPEOP_OTHER :
+            default :
+               derivative = SCIP_INVALID;
+               SCIP_CALL( SCIPexprhdlrBwDiffExpr(expr->exprhdlr, set, NULL, expr, c, &derivative, NULL, 0.0) );
+               break;
+         }
+
+         if( derivative == SCIP_INVALID || !SCIPisFinite(derivative) )
+         {
+            rootexpr->derivative = SCIP_INVALID;
+            return SCIP_OKAY;
+         }
+
+         adjoints[pos] += adjoints[i] * derivative;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the activity of an expression whose children have up-to-date activities */
+static
+SCIP_RETCODE evalActivityExpr(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPR*            expr                /**< expression */
+   )
+{
+   /* we should not evaluate this expression if its activity was already uptodate */
+   assert(expr->activitytag < stat->domchgcount);
+
+   /* reset activity to entire if invalid, so we can use it as starting point below */
+   SCIPintervalSetEntire(SCIP_INTERVAL_INFINITY, &expr->activity);
+
+#ifdef DEBUG_PROP
+   SCIPsetDebugMsg(set, "interval evaluation of expr %p ", (void*)expr);
+   SCIP_CALL( SCIPprintExpr(set->scip, expr, NULL) );
+   SCIPsetDebugMsgPrint(set, "\n");
+#endif
+
+   /* call the inteval callback of the exprhdlr */
+   SCIP_CALL( SCIPexprhdlrIntEvalExpr(expr->exprhdlr, set, expr, &expr->activity, NULL, NULL) );
+#ifdef DEBUG_PROP
+   SCIPsetDebugMsg(set, " exprhdlr <%s>::inteval = [%.20g, %.20g]", expr->exprhdlr->name, expr->activity.inf,
+         expr->activity.sup);
+#endif
+
+   /* if expression is integral, then we try to tighten the interval bounds a bit
+    * this should undo the addition of some unnecessary safety added by use of nextafter() in interval
+    * arithmetics, e.g., when doing pow() it would be ok to use ceil() and floor(), but for safety we
+    * use SCIPceil and SCIPfloor for now the default intevalVar does not relax variables, so can omit
+    * expressions without children (constants should be ok, too)
+    */
+   if( expr->isintegral && expr->nchildren > 0 )
+   {
+      if( expr->activity.inf > -SCIP_INTERVAL_INFINITY )
+         expr->activity.inf = SCIPsetCeil(set, expr->activity.inf);
+      if( expr->activity.sup <  SCIP_INTERVAL_INFINITY )
+         expr->activity.sup = SCIPsetFloor(set, expr->activity.sup);
+#ifdef DEBUG_PROP
+      SCIPsetDebugMsg(set, " applying integrality: [%.20g, %.20g]\n", expr->activity.inf, expr->activity.sup);
+#endif
+   }
+
+   /* mark activity as empty if either the lower/upper bound is above/below +/- SCIPinfinity()
+    * TODO this is a problem if dual-presolve fixed a variable to +/- infinity
+    */
+   if( SCIPsetIsInfinity(set, expr->activity.inf) || SCIPsetIsInfinity(set, -expr->activity.sup) )
+   {
+      SCIPsetDebugMsg(set, "treat activity [%g,%g] as empty as beyond infinity\n", expr->activity.inf, expr->activity.sup);
+      SCIPintervalSetEmpty(&expr->activity);
+   }
+
+   /* remember that activity is uptodate now */
+   expr->activitytag = stat->domchgcount;
+
+   return SCIP_OKAY;
+}
+
+/** evaluates and forward-differentiates a single expression whose children have been processed
+ *
+ * Sets *success to FALSE if the expression could not be evaluated or differentiated.
+ */
+static
+SCIP_RETCODE evalAndDiffExpr(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   SCIP_Longint          soltag,             /**< tag that uniquely identifies the solution (with its values), or 0. */
+   SCIP_SOL*             direction,          /**< direction for directional derivative */
+   SCIP_Bool*            success             /**< buffer to store whether evaluation and differentiation succeeded */
+   )
+{
+   *success = FALSE;
+
+   /* evaluate expression only if necessary */
+   if( soltag == 0 || expr->evaltag != soltag )
+   {
+      SCIP_CALL( SCIPexprhdlrEvalExpr(expr->exprhdlr, set, NULL, expr, &expr->evalvalue, NULL, sol) );
+
+      expr->evaltag = soltag;
+   }
+
+   if( expr->evalvalue == SCIP_INVALID )
+      return SCIP_OKAY;
+
+   if( expr->difftag != stat->exprlastdifftag )
+   {
+      /* compute forward diff */
+      SCIP_CALL( SCIPexprhdlrFwDiffExpr(expr->exprhdlr, set, expr, &expr->dot, direction) );
+
+      if( expr->dot == SCIP_INVALID )
+         return SCIP_OKAY;
+
+      expr->derivative = 0.0;
+      expr->bardot = 0.0;
+      expr->difftag = stat->exprlastdifftag;
+   }
+
+   *success = TRUE;
+
+   return SCIP_OKAY;
+}
+
 /** evaluate and forward-differentiate expression
  *
  * also initializes derivative and bardot to 0.0
@@ -196,6 +827,8 @@ SCIP_RETCODE evalAndDiff(
    )
 {
    SCIP_EXPRITER* it;
+   SCIP_EXPRTAPE* tape;
+   SCIP_Bool success;
 
    assert(set != NULL);
    assert(stat != NULL);
@@ -212,35 +845,33 @@ SCIP_RETCODE evalAndDiff(
    /* start a new difftag */
    ++stat->exprlastdifftag;
 
-   SCIP_CALL( SCIPexpriterCreate(stat, blkmem, &it) );
-   SCIP_CALL( SCIPexpriterInit(it, expr, SCIP_EXPRITER_DFS, TRUE) );
-   SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_LEAVEEXPR);
-
-   for( expr = SCIPexpriterGetCurrent(it); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+   /* process subexpressions in the order of the tape, if compiled */
+   SCIP_CALL( tapeGet(set, stat, blkmem, expr, &tape) );
+   if( tape != NULL )
    {
-      /* evaluate expression only if necessary */
-      if( soltag == 0 || expr->evaltag != soltag )
+      int i;
+
+      for( i = 0; i < tape->nops; ++i )
       {
-         SCIP_CALL( SCIPexprhdlrEvalExpr(expr->exprhdlr, set, NULL, expr, &expr->evalvalue, NULL, sol) );
+         SCIP_CALL( evalAndDiffExpr(set, stat, tape->exprs[i], sol, soltag, direction, &success) );
 
-         expr->evaltag = soltag;
+         if( !success )
+            break;
       }
 
-      if( expr->evalvalue == SCIP_INVALID )
-         break;
+      return SCIP_OKAY;
+   }
 
-      if( expr->difftag != stat->exprlastdifftag )
-      {
-         /* compute forward diff */
-         SCIP_CALL( SCIPexprhdlrFwDiffExpr(expr->exprhdlr, set, expr, &expr->dot, direction) );
+   SCIP_CALL( SCIPexpriterCreate(stat, blkmem, &it) );
+   SCIP_CALL( SCIPexpriterInit(it, expr, SCIP_EXPRITER_DFS, TRUE) );
+   SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_LEAVEEXPR);
 
-         if( expr->dot == SCIP_INVALID )
-            break;
+   for( expr = SCIPexpriterGetCurrent(it); !SCIPexpriterIsEnd(it); expr = SCIPexpriterGetNext(it) )
+   {
+      SCIP_CALL( evalAndDiffExpr(set, stat, expr, sol, soltag, direction, &success) );
 
-         expr->derivative = 0.0;
-         expr->bardot = 0.0;
-         expr->difftag = stat->exprlastdifftag;
-      }
+      if( !success )
+         break;
    }
 
    SCIPexpriterFree(&it);
@@ -265,6 +896,7 @@ SCIP_RETCODE evalAndDiff(
 #undef SCIPexprhdlrSetHash
 #undef SCIPexprhdlrSetCompare
 #undef SCIPexprhdlrSetDiff
+#undef SCIPexprhdlrSetEvalBatch
 #undef SCIPexprhdlrSetIntEval
 #undef SCIPexprhdlrSetSimplify
 #undef SCIPexprhdlrSetReverseProp
@@ -277,6 +909,7 @@ SCIP_RETCODE evalAndDiff(
 #undef SCIPexprhdlrHasPrint
 #undef SCIPexprhdlrHasBwdiff
 #undef SCIPexprhdlrHasFwdiff
+#undef SCIPexprhdlrHasEvalBatch
 #undef SCIPexprhdlrHasIntEval
 #undef SCIPexprhdlrHasEstimate
 #undef SCIPexprhdlrHasInitEstimates
@@ -484,6 +1117,17 @@ void SCIPexprhdlrSetDiff(
    exprhdlr->bwfwdiff = bwfwdiff;
 }
 
+/** set the batched point evaluation callback of an expression handler */
+void SCIPexprhdlrSetEvalBatch(
+   SCIP_EXPRHDLR*        exprhdlr,           /**< expression handler */
+   SCIP_DECL_EXPREVALBATCH((*evalbatch))     /**< batched point evaluation callback (can be NULL) */
+   )
+{
+   assert(exprhdlr != NULL);
+
+   exprhdlr->evalbatch = evalbatch;
+}
+
 /** set the interval evaluation callback of an expression handler */
 void SCIPexprhdlrSetIntEval(
    SCIP_EXPRHDLR*        exprhdlr,           /**< expression handler */
@@ -611,6 +1255,16 @@ SCIP_Bool SCIPexprhdlrHasFwdiff(
    return exprhdlr->fwdiff != NULL;
 }
 
+/** returns whether expression handler implements the batched point evaluation callback */
+SCIP_Bool SCIPexprhdlrHasEvalBatch(
+   SCIP_EXPRHDLR*        exprhdlr            /**< expression handler */
+   )
+{
+   assert(exprhdlr != NULL);
+
+   return exprhdlr->evalbatch != NULL;
+}
+
 /** returns whether expression handler implements the interval evaluation callback */
 SCIP_Bool SCIPexprhdlrHasIntEval(
    SCIP_EXPRHDLR*        exprhdlr            /**< expression handler */
@@ -1784,6 +2438,7 @@ SCIP_RETCODE SCIPexprCreate(
 /** appends child to the children list of expr */
 SCIP_RETCODE SCIPexprAppendChild(
    SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics, or NULL if no problem exists */
    BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_EXPR*            expr,               /**< expression */
    SCIP_EXPR*            child               /**< expression to be appended */
@@ -1806,6 +2461,10 @@ SCIP_RETCODE SCIPexprAppendChild(
    /* capture child */
    SCIPexprCapture(child);
 
+   /* invalidate evaluation tapes */
+   if( stat != NULL )
+      ++stat->exprlaststructtag;
+
    return SCIP_OKAY;
 }
 
@@ -1839,6 +2498,9 @@ SCIP_RETCODE SCIPexprReplaceChild(
    SCIP_CALL( SCIPexprRelease(set, stat, blkmem, &(expr->children[childidx])) );
    expr->children[childidx] = newchild;
 
+   /* invalidate evaluation tapes */
+   ++stat->exprlaststructtag;
+
    return SCIP_OKAY;
 }
 
@@ -1864,6 +2526,9 @@ SCIP_RETCODE SCIPexprRemoveChildren(
 
    expr->nchildren = 0;
 
+   /* invalidate evaluation tapes */
+   ++stat->exprlaststructtag;
+
    return SCIP_OKAY;
 }
 
@@ -2004,7 +2669,7 @@ SCIP_RETCODE SCIPexprCopy(
             }
 
             /* append child to exprcopy */
-            SCIP_CALL( SCIPexprAppendChild(targetset, targetblkmem, exprcopy, childcopy) );
+            SCIP_CALL( SCIPexprAppendChild(targetset, targetstat, targetblkmem, exprcopy, childcopy) );
 
             /* release childcopy (still captured by exprcopy) */
             SCIP_CALL( SCIPexprRelease(targetset, targetstat, targetblkmem, &childcopy) );
@@ -2661,6 +3326,7 @@ SCIP_RETCODE SCIPexprEval(
    )
 {
    SCIP_EXPRITER* it;
+   SCIP_EXPRTAPE* tape;
 
    assert(set != NULL);
    assert(stat != NULL);
@@ -2677,6 +3343,15 @@ SCIP_RETCODE SCIPexprEval(
    expr->evalvalue = SCIP_INVALID;
    expr->evaltag = soltag;
 
+   /* evaluate on the tape, if compiled */
+   SCIP_CALL( tapeGet(set, stat, blkmem, expr, &tape) );
+   if( tape != NULL )
+   {
+      SCIP_CALL( tapeEval(set, stat, tape, sol, soltag) );
+
+      return SCIP_OKAY;
+   }
+
    SCIP_CALL( SCIPexpriterCreate(stat, blkmem, &it) );
    SCIP_CALL( SCIPexpriterInit(it, expr, SCIP_EXPRITER_DFS, TRUE) );
    SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_VISITINGCHILD | SCIP_EXPRITER_LEAVEEXPR);
@@ -2735,6 +3410,55 @@ TERMINATE:
    return SCIP_OKAY;
 }
 
+/** evaluates an expression at a block of points
+ *
+ * The values of the variables are given in structure-of-arrays layout, that is, varvals[i * npoints + p] is the
+ * value of the variable with index i at point p. If varidxs is NULL, then the problem indices of the variables are
+ * used. If an evaluation error occurs at a point, the value at that point is set to SCIP_INVALID.
+ *
+ * The expression is evaluated on its tape, see SCIPexprCompile(). If it has not been compiled, then a temporary tape
+ * is created. The values stored in the expressions are not changed.
+ */
+SCIP_RETCODE SCIPexprEvalBatch(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   int                   npoints,            /**< number of points */
+   SCIP_HASHMAP*         varidxs,            /**< map from variables to indices in varvals, or NULL to use problem indices */
+   SCIP_Real*            varvals,            /**< values of variables at the points */
+   SCIP_Real*            vals                /**< buffer to store the values of the expression at the points */
+   )
+{
+   SCIP_EXPRTAPE* tape;
+   SCIP_RETCODE retcode;
+
+   assert(set != NULL);
+   assert(stat != NULL);
+   assert(blkmem != NULL);
+   assert(bufmem != NULL);
+   assert(expr != NULL);
+   assert(npoints >= 0);
+
+   if( npoints == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( tapeGet(set, stat, blkmem, expr, &tape) );
+   if( tape != NULL )
+   {
+      SCIP_CALL( tapeEvalBatch(set, bufmem, tape, npoints, varidxs, varvals, vals) );
+
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( tapeCreate(set, stat, blkmem, expr, &tape) );
+   retcode = tapeEvalBatch(set, bufmem, tape, npoints, varidxs, varvals, vals);
+   tapeFree(blkmem, &tape);
+
+   return retcode;
+}
+
 /** evaluates gradient of an expression for a given point
  *
  * Initiates an expression walk to also evaluate children, if necessary.
@@ -2752,6 +3476,7 @@ SCIP_RETCODE SCIPexprEvalGradient(
    )
 {
    SCIP_EXPRITER* it;
+   SCIP_EXPRTAPE* tape;
    SCIP_EXPR* expr;
    SCIP_EXPR* child;
    SCIP_Real derivative;
@@ -2778,6 +3503,28 @@ SCIP_RETCODE SCIPexprEvalGradient(
       return SCIP_OKAY;
    }
 
+   /* differentiate on the tape, if compiled
+    * the tape is up-to-date, since it was used for evaluation
+    */
+   if( rootexpr->tape != NULL )
+   {
+      SCIP_CALL( tapeGet(set, stat, blkmem, rootexpr, &tape) );
+      assert(tape != NULL);
+
+      /* values of subexpressions reused from an earlier evaluation are not on the tape */
+      if( soltag != 0 )
+      {
+         int i;
+
+         for( i = 0; i < tape->nops; ++i )
+            tape->vals[i] = tape->exprs[i]->evalvalue;
+      }
+
+      SCIP_CALL( tapeEvalGradient(set, stat, tape, rootexpr) );
+
+      return SCIP_OKAY;
+   }
+
    difftag = ++(stat->exprlastdifftag);
 
    rootexpr->derivative = 1.0;
@@ -2955,6 +3702,7 @@ SCIP_RETCODE SCIPexprEvalActivity(
    )
 {
    SCIP_EXPRITER* it;
+   SCIP_EXPRTAPE* tape;
    SCIP_EXPR* expr;
 
    assert(set != NULL);
@@ -2984,6 +3732,23 @@ SCIP_RETCODE SCIPexprEvalActivity(
       return SCIP_OKAY;
    }
 
+   /* evaluate activities of subexpressions that are not up-to-date in the order of the tape, if compiled */
+   SCIP_CALL( tapeGet(set, stat, blkmem, rootexpr, &tape) );
+   if( tape != NULL )
+   {
+      int i;
+
+      for( i = 0; i < tape->nops; ++i )
+      {
+         if( tape->exprs[i]->activitytag != stat->domchgcount )
+         {
+            SCIP_CALL( evalActivityExpr(set, stat, tape->exprs[i]) );
+         }
+      }
+
+      return SCIP_OKAY;
+   }
+
    SCIP_CALL( SCIPexpriterCreate(stat, blkmem, &it) );
    SCIP_CALL( SCIPexpriterInit(it, rootexpr, SCIP_EXPRITER_DFS, TRUE) );
    SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_VISITINGCHILD | SCIP_EXPRITER_LEAVEEXPR);
@@ -3009,53 +3774,7 @@ SCIP_RETCODE SCIPexprEvalActivity(
 
          case SCIP_EXPRITER_LEAVEEXPR :
          {
-            /* we should not have entered this expression if its activity was already uptodate */
-            assert(expr->activitytag < stat->domchgcount);
-
-            /* reset activity to entire if invalid, so we can use it as starting point below */
-            SCIPintervalSetEntire(SCIP_INTERVAL_INFINITY, &expr->activity);
-
-#ifdef DEBUG_PROP
-            SCIPsetDebugMsg(set, "interval evaluation of expr %p ", (void*)expr);
-            SCIP_CALL( SCIPprintExpr(set->scip, expr, NULL) );
-            SCIPsetDebugMsgPrint(set, "\n");
-#endif
-
-            /* call the inteval callback of the exprhdlr */
-            SCIP_CALL( SCIPexprhdlrIntEvalExpr(expr->exprhdlr, set, expr, &expr->activity, NULL, NULL) );
-#ifdef DEBUG_PROP
-            SCIPsetDebugMsg(set, " exprhdlr <%s>::inteval = [%.20g, %.20g]", expr->exprhdlr->name, expr->activity.inf,
-                  expr->activity.sup);
-#endif
-
-            /* if expression is integral, then we try to tighten the interval bounds a bit
-             * this should undo the addition of some unnecessary safety added by use of nextafter() in interval
-             * arithmetics, e.g., when doing pow() it would be ok to use ceil() and floor(), but for safety we
-             * use SCIPceil and SCIPfloor for now the default intevalVar does not relax variables, so can omit
-             * expressions without children (constants should be ok, too)
-             */
-            if( expr->isintegral && expr->nchildren > 0 )
-            {
-               if( expr->activity.inf > -SCIP_INTERVAL_INFINITY )
-                  expr->activity.inf = SCIPsetCeil(set, expr->activity.inf);
-               if( expr->activity.sup <  SCIP_INTERVAL_INFINITY )
-                  expr->activity.sup = SCIPsetFloor(set, expr->activity.sup);
-#ifdef DEBUG_PROP
-               SCIPsetDebugMsg(set, " applying integrality: [%.20g, %.20g]\n", expr->activity.inf, expr->activity.sup);
-#endif
-            }
-
-            /* mark activity as empty if either the lower/upper bound is above/below +/- SCIPinfinity()
-             * TODO this is a problem if dual-presolve fixed a variable to +/- infinity
-             */
-            if( SCIPsetIsInfinity(set, expr->activity.inf) || SCIPsetIsInfinity(set, -expr->activity.sup) )
-            {
-               SCIPsetDebugMsg(set, "treat activity [%g,%g] as empty as beyond infinity\n", expr->activity.inf, expr->activity.sup);
-               SCIPintervalSetEmpty(&expr->activity);
-            }
-
-            /* remember that activity is uptodate now */
-            expr->activitytag = stat->domchgcount;
+            SCIP_CALL( evalActivityExpr(set, stat, expr) );
 
             break;
          }
@@ -3074,6 +3793,46 @@ SCIP_RETCODE SCIPexprEvalActivity(
    return SCIP_OKAY;
 }
 
+/** compiles an expression into an evaluation tape
+ *
+ * After compilation, SCIPexprEval(), SCIPexprEvalGradient(), SCIPexprEvalHessianDir(), and SCIPexprEvalActivity()
+ * (if the owner does not evaluate the activity) loop over the tape instead of iterating over the expression.
+ * If the children of any expression change, the tape is recompiled on its next use.
+ * An existing tape is recompiled.
+ */
+SCIP_RETCODE SCIPexprCompile(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            rootexpr            /**< expression */
+   )
+{
+   assert(set != NULL);
+   assert(stat != NULL);
+   assert(blkmem != NULL);
+   assert(rootexpr != NULL);
+
+   if( rootexpr->tape != NULL )
+      tapeFree(blkmem, &rootexpr->tape);
+
+   SCIP_CALL( tapeCreate(set, stat, blkmem, rootexpr, &rootexpr->tape) );
+
+   return SCIP_OKAY;
+}
+
+/** frees the evaluation tape of an expression, if any */
+void SCIPexprFreeTape(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            expr                /**< expression */
+   )
+{
+   assert(blkmem != NULL);
+   assert(expr != NULL);
+
+   if( expr->tape != NULL )
+      tapeFree(blkmem, &expr->tape);
+}
+
 /** compare expressions
  *
  * @return -1, 0 or 1 if expr1 <, =, > expr2, respectively
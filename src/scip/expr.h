@@ -383,6 +383,7 @@ SCIP_RETCODE SCIPexprCreate(
 SCIP_EXPORT  /* need SCIP_EXPORT here, because func is exposed in API via SCIPappendExprChild() macro */
 SCIP_RETCODE SCIPexprAppendChild(
    SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics, or NULL if no problem exists */
    BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_EXPR*            expr,               /**< expression */
    SCIP_EXPR*            child               /**< expression to be appended */
@@ -570,6 +571,26 @@ SCIP_RETCODE SCIPexprEval(
    SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
    );
 
+/** evaluates an expression at a block of points
+ *
+ * The values of the variables are given in structure-of-arrays layout, that is, varvals[i * npoints + p] is the
+ * value of the variable with index i at point p. If varidxs is NULL, then the problem indices of the variables are
+ * used. If an evaluation error occurs at a point, the value at that point is set to SCIP_INVALID.
+ * The values stored in the expressions are not changed.
+ */
+SCIP_EXPORT  /* need SCIP_EXPORT here, because func is exposed in API via SCIPevalExprBatch() macro */
+SCIP_RETCODE SCIPexprEvalBatch(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   BMS_BUFMEM*           bufmem,             /**< buffer memory */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   int                   npoints,            /**< number of points */
+   SCIP_HASHMAP*         varidxs,            /**< map from variables to indices in varvals, or NULL to use problem indices */
+   SCIP_Real*            varvals,            /**< values of variables at the points */
+   SCIP_Real*            vals                /**< buffer to store the values of the expression at the points */
+   );
+
 /** evaluates gradient of an expression for a given point
  *
  * Initiates an expression walk to also evaluate children, if necessary.
@@ -623,6 +644,28 @@ SCIP_RETCODE SCIPexprEvalActivity(
    SCIP_EXPR*            rootexpr            /**< expression */
    );
 
+/** compiles an expression into an evaluation tape
+ *
+ * After compilation, SCIPexprEval(), SCIPexprEvalGradient(), SCIPexprEvalHessianDir(), and SCIPexprEvalActivity()
+ * (if the owner does not evaluate the activity) loop over the tape instead of iterating over the expression.
+ * If the children of any expression change, the tape is recompiled on its next use.
+ * An existing tape is recompiled.
+ */
+SCIP_EXPORT  /* need SCIP_EXPORT here, because func is exposed in API via SCIPcompileExpr() macro */
+SCIP_RETCODE SCIPexprCompile(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            rootexpr            /**< expression */
+   );
+
+/** frees the evaluation tape of an expression, if any */
+SCIP_EXPORT  /* need SCIP_EXPORT here, because func is exposed in API via SCIPfreeExprTape() macro */
+void SCIPexprFreeTape(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_EXPR*            expr                /**< expression */
+   );
+
 /** compare expressions
  *
  * @return -1, 0 or 1 if expr1 <, =, > expr2, respectively
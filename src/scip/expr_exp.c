@@ -269,6 +269,27 @@ SCIP_DECL_EXPREVAL(evalExp)
    return SCIP_OKAY;
 }
 
+/** expression batched point evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchExp)
+{  /*lint --e{715}*/
+   SCIP_Real* childval;
+   int p;
+
+   assert(expr != NULL);
+   assert(SCIPexprGetNChildren(expr) == 1);
+   assert(childvals != NULL);
+
+   childval = childvals[0];
+
+   /**! [SnippetExprEvalBatchExp] */
+   for( p = 0; p < npoints; ++p )
+      vals[p] = (childval[p] == SCIP_INVALID) ? SCIP_INVALID : exp(childval[p]); /*lint !e777*/
+   /**! [SnippetExprEvalBatchExp] */
+
+   return SCIP_OKAY;
+}
+
 /** expression derivative evaluation callback */
 static
 SCIP_DECL_EXPRBWDIFF(bwdiffExp)
@@ -495,6 +516,7 @@ SCIP_RETCODE SCIPincludeExprhdlrExp(
    SCIPexprhdlrSetCopyFreeData(exprhdlr, copydataExp, freedataExp);
    SCIPexprhdlrSetSimplify(exprhdlr, simplifyExp);
    SCIPexprhdlrSetParse(exprhdlr, parseExp);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchExp);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalExp);
    SCIPexprhdlrSetEstimate(exprhdlr, initestimatesExp, estimateExp);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropExp);
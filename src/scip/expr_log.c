@@ -300,6 +300,26 @@ SCIP_DECL_EXPREVAL(evalLog)
    return SCIP_OKAY;
 }
 
+/** expression batched point evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchLog)
+{  /*lint --e{715}*/
+   SCIP_Real* childval;
+   int p;
+
+   assert(expr != NULL);
+   assert(SCIPexprGetNChildren(expr) == 1);
+   assert(childvals != NULL);
+
+   childval = childvals[0];
+
+   /* SCIP_INVALID is positive, so it needs to be checked explicitly */
+   for( p = 0; p < npoints; ++p )
+      vals[p] = (childval[p] <= 0.0 || childval[p] == SCIP_INVALID) ? SCIP_INVALID : log(childval[p]); /*lint !e777*/
+
+   return SCIP_OKAY;
+}
+
 /** expression derivative evaluation callback */
 static
 SCIP_DECL_EXPRBWDIFF(bwdiffLog)
@@ -610,6 +630,7 @@ SCIP_RETCODE SCIPincludeExprhdlrLog(
    SCIPexprhdlrSetCopyFreeData(exprhdlr, copydataLog, freedataLog);
    SCIPexprhdlrSetSimplify(exprhdlr, simplifyLog);
    SCIPexprhdlrSetParse(exprhdlr, parseLog);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchLog);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalLog);
    SCIPexprhdlrSetEstimate(exprhdlr, initestimatesLog, estimateLog);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropLog);
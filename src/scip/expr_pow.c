@@ -1909,6 +1909,48 @@ SCIP_DECL_EXPREVAL(evalPow)
    return SCIP_OKAY;
 }
 
+/** expression batched point evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchPow)
+{  /*lint --e{715}*/
+   SCIP_Real* childval;
+   SCIP_Real exponent;
+   int p;
+
+   assert(expr != NULL);
+   assert(SCIPexprGetNChildren(expr) == 1);
+   assert(childvals != NULL);
+
+   exponent = SCIPgetExponentExprPow(expr);
+   childval = childvals[0];
+
+   /* avoid the generic pow() for the common exponents */
+   if( exponent == 2.0 )
+   {
+      for( p = 0; p < npoints; ++p )
+         vals[p] = childval[p] * childval[p];
+   }
+   else if( exponent == 0.5 )
+   {
+      for( p = 0; p < npoints; ++p )
+         vals[p] = childval[p] < 0.0 ? SCIP_INVALID : sqrt(childval[p]);
+   }
+   else
+   {
+      for( p = 0; p < npoints; ++p )
+         vals[p] = pow(childval[p], exponent);
+   }
+
+   /* invalid children and domain, pole, or range errors, see also evalPow() */
+   for( p = 0; p < npoints; ++p )
+   {
+      if( childval[p] == SCIP_INVALID || !SCIPisFinite(vals[p]) || vals[p] == HUGE_VAL || vals[p] == -HUGE_VAL ) /*lint !e777*/
+         vals[p] = SCIP_INVALID;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** derivative evaluation callback
  *
  * computes <gradient, children.dot>
@@ -2771,6 +2813,34 @@ SCIP_DECL_EXPREVAL(evalSignpower)
    return SCIP_OKAY;
 }
 
+/** expression batched point evaluation callback */
+static
+SCIP_DECL_EXPREVALBATCH(evalbatchSignpower)
+{  /*lint --e{715}*/
+   SCIP_Real* childval;
+   SCIP_Real exponent;
+   int p;
+
+   assert(expr != NULL);
+   assert(SCIPexprGetNChildren(expr) == 1);
+   assert(childvals != NULL);
+
+   exponent = SCIPgetExponentExprPow(expr);
+   childval = childvals[0];
+
+   for( p = 0; p < npoints; ++p )
+      vals[p] = SIGN(childval[p]) * pow(REALABS(childval[p]), exponent);
+
+   /* invalid children and range errors, see also evalSignpower() */
+   for( p = 0; p < npoints; ++p )
+   {
+      if( childval[p] == SCIP_INVALID || !SCIPisFinite(vals[p]) || vals[p] == HUGE_VAL || vals[p] == -HUGE_VAL ) /*lint !e777*/
+         vals[p] = SCIP_INVALID;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** expression derivative evaluation callback */
 static
 SCIP_DECL_EXPRBWDIFF(bwdiffSignpower)
@@ -3133,6 +3203,7 @@ SCIP_RETCODE SCIPincludeExprhdlrPow(
    SCIPexprhdlrSetCopyFreeData(exprhdlr, copydataPow, freedataPow);
    SCIPexprhdlrSetSimplify(exprhdlr, simplifyPow);
    SCIPexprhdlrSetPrint(exprhdlr, printPow);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchPow);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalPow);
    SCIPexprhdlrSetEstimate(exprhdlr, initestimatesPow, estimatePow);
    SCIPexprhdlrSetReverseProp(exprhdlr, reversepropPow);
@@ -3174,6 +3245,7 @@ SCIP_RETCODE SCIPincludeExprhdlrSignpower(
    SCIPexprhdlrSetCopyFreeData(exprhdlr, copydataPow, freedataPow);
    SCIPexprhdlrSetSimplify(exprhdlr, simplifySignpower);
    SCIPexprhdlrSetPrint(exprhdlr, printSignpower);
+   SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatchSignpower);
    SCIPexprhdlrSetParse(exprhdlr, parseSignpower);
    SCIPexprhdlrSetIntEval(exprhdlr, intevalSignpower);
    SCIPexprhdlrSetEstimate(exprhdlr, initestimatesSignpower, estimateSignpower);
@@ -0,0 +1 @@
+#define SCIP_GITHASH "8679fbb-dirty"
@@ -946,6 +946,8 @@ SCIP_RETCODE doHeurCreate(
    (*heur)->delaypos = -1;
    (*heur)->timingmask = timingmask;
    (*heur)->usessubscip = usessubscip;
+   (*heur)->async = FALSE;
+   (*heur)->delegated = FALSE;
    (*heur)->heurcopy = heurcopy;
    (*heur)->heurfree = heurfree;
    (*heur)->heurinit = heurinit;
@@ -1289,6 +1291,10 @@ SCIP_RETCODE SCIPheurExec(
 
    *result = SCIP_DIDNOTRUN;
 
+   /* heuristics that are delegated to an asynchronous worker are not executed at the nodes */
+   if( heur->delegated )
+      return SCIP_OKAY;
+
    delayed = FALSE;
    execute = SCIPheurShouldBeExecuted(heur, depth, lpstateforkdepth, heurtiming, &delayed);
 
@@ -1510,6 +1516,53 @@ SCIP_Bool SCIPheurUsesSubscip(
    return heur->usessubscip;
 }
 
+/** marks whether the primal heuristic can be executed asynchronously on a copy of the problem
+ *
+ *  Such a heuristic must only rely on the problem and the solutions of the SCIP instance it is called for, since the
+ *  copy is solved in a separate thread; see the async heuristic.
+ */
+void SCIPheurSetAsync(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_Bool             async               /**< can the heuristic be executed asynchronously? */
+   )
+{
+   assert(heur != NULL);
+
+   heur->async = async;
+}
+
+/** can the primal heuristic be executed asynchronously on a copy of the problem? */
+SCIP_Bool SCIPheurIsAsync(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   )
+{
+   assert(heur != NULL);
+
+   return heur->async;
+}
+
+/** sets whether the primal heuristic is delegated to an asynchronous worker and thus not executed at the nodes */
+void SCIPheurSetDelegated(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_Bool             delegated           /**< is the heuristic delegated to an asynchronous worker? */
+   )
+{
+   assert(heur != NULL);
+   assert(heur->async || !delegated);
+
+   heur->delegated = delegated;
+}
+
+/** is the primal heuristic delegated to an asynchronous worker and thus not executed at the nodes? */
+SCIP_Bool SCIPheurIsDelegated(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   )
+{
+   assert(heur != NULL);
+
+   return heur->delegated;
+}
+
 /** gets priority of primal heuristic */
 int SCIPheurGetPriority(
    SCIP_HEUR*            heur                /**< primal heuristic */
@@ -69,6 +69,7 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #define HEUR_NAME             "alns"
@@ -147,6 +148,7 @@
 #define DEFAULT_USESUBSCIPHEURS  FALSE /**< should the heuristic activate other sub-SCIP heuristics during its search?  */
 #define DEFAULT_COPYCUTS         FALSE /**< should cutting planes be copied to the sub-SCIP? */
 #define DEFAULT_REWARDFILENAME   "-"   /**< file name to store all rewards and the selection of the bandit */
+#define DEFAULT_NPARALLEL        1     /**< number of neighborhoods that are solved concurrently in one call (1: sequential) */
 
 /* individual random seeds */
 #define DEFAULT_SEED 113
@@ -208,6 +210,7 @@
 #define EVENTHDLR_NAME         "Alns"
 #define EVENTHDLR_DESC         "LP event handler for " HEUR_NAME " heuristic"
 #define SCIP_EVENTTYPE_ALNS (SCIP_EVENTTYPE_LPSOLVED | SCIP_EVENTTYPE_SOLFOUND | SCIP_EVENTTYPE_BESTSOLFOUND)
+#define SCIP_EVENTTYPE_ALNSPARALLEL (SCIP_EVENTTYPE_LPSOLVED | SCIP_EVENTTYPE_BESTSOLFOUND | SCIP_EVENTTYPE_NODESOLVED)
 
 /* properties of the ALNS neighborhood statistics table */
 #define TABLE_NAME_NEIGHBORHOOD                  "neighborhood"
@@ -451,6 +454,7 @@ struct SCIP_HeurData
    int                   ndelayedcalls;      /**< the number of delayed calls */
    int                   maxcallssamesol;    /**< number of allowed executions of the heuristic on the same incumbent solution
                                               *   (-1: no limit, 0: number of active neighborhoods) */
+   int                   nparallel;          /**< number of neighborhoods that are solved concurrently in one call (1: sequential) */
    SCIP_Longint          firstcallthissol;   /**< counter for the number of calls on this incumbent */
    char                  banditalgo;         /**< the bandit algorithm: (u)pper confidence bounds, (e)xp.3, epsilon (g)reedy */
    SCIP_Bool             useredcost;         /**< should reduced cost scores be used for variable prioritization? */
@@ -472,6 +476,15 @@ struct SCIP_HeurData
 };
 
 /** event handler data */
+/** data that is shared between the sub-SCIPs of a parallel ALNS call */
+struct AlnsShared
+{
+   SCIP_LOCK*            lock;               /**< lock to protect the shared data */
+   SCIP_Real             bestobj;            /**< best objective value of a solution found by any of the sub-SCIPs */
+};
+
+typedef struct AlnsShared ALNSSHARED;
+
 struct SCIP_EventData
 {
    SCIP_VAR**            subvars;            /**< the variables of the subproblem */
@@ -481,6 +494,7 @@ struct SCIP_EventData
    SCIP_Real             lplimfac;           /**< limit fraction of LPs per node to interrupt sub-SCIP */
    NH_STATS*             runstats;           /**< run statistics for the current neighborhood */
    SCIP_Bool             allrewardsmode;     /**< true if solutions should only be checked for reward comparisons */
+   ALNSSHARED*           shared;             /**< data shared with the other sub-SCIPs of a parallel call, or NULL */
 };
 
 /** represents limits for the sub-SCIP solving process */
@@ -494,6 +508,20 @@ struct SolveLimits
 
 typedef struct SolveLimits SOLVELIMITS;
 
+/** sub-SCIP of a neighborhood that is solved as a job of a parallel ALNS call */
+struct AlnsJob
+{
+   SCIP*                 subscip;            /**< sub-SCIP of the neighborhood */
+   SCIP_VAR**            subvars;            /**< sub-SCIP variables in the order of the main SCIP variables */
+   SCIP_EVENTDATA        eventdata;          /**< data of the event handler of the sub-SCIP */
+   SCIP_CLOCK*           clock;              /**< clock of the sub-SCIP to measure the solving time of the job */
+   NH_STATS              runstats;           /**< run statistics of the neighborhood */
+   SCIP_Real             targetfixingrate;   /**< target fixing rate of the neighborhood */
+   int                   neighborhoodidx;    /**< index of the neighborhood */
+};
+
+typedef struct AlnsJob ALNSJOB;
+
 /** data structure that can be used for variable prioritization for additional fixings */
 struct VarPrio
 {
@@ -924,25 +952,23 @@ SCIP_RETCODE neighborhoodExit(
    return SCIP_OKAY;
 }
 
-/** creates a new solution for the original problem by copying the solution of the subproblem */
+/** creates a new solution for the original problem by copying the given solution of the subproblem */
 static
 SCIP_RETCODE transferSolution(
    SCIP*                 subscip,            /**< SCIP data structure of the subproblem */
+   SCIP_SOL*             subsol,             /**< solution of the subproblem */
    SCIP_EVENTDATA*       eventdata           /**< event handler data */
    )
 {
    SCIP*      sourcescip;         /* original SCIP data structure */
    SCIP_VAR** subvars;            /* the variables of the subproblem */
    SCIP_HEUR* heur;               /* alns heuristic structure */
-   SCIP_SOL*  subsol;             /* solution of the subproblem */
    SCIP_SOL*  newsol;             /* solution to be created for the original problem */
    SCIP_Bool  success;
    NH_STATS*  runstats;
    SCIP_SOL*  oldbestsol;
 
    assert(subscip != NULL);
-
-   subsol = SCIPgetBestSol(subscip);
    assert(subsol != NULL);
 
    sourcescip = eventdata->sourcescip;
@@ -1017,7 +1043,69 @@ SCIP_DECL_EVENTEXEC(eventExecAlns)
    case SCIP_EVENTTYPE_SOLFOUND:
    case SCIP_EVENTTYPE_BESTSOLFOUND:
       /* try to transfer the solution to the original SCIP */
-      SCIP_CALL( transferSolution(scip, eventdata) );
+      SCIP_CALL( transferSolution(scip, SCIPgetBestSol(scip), eventdata) );
+      break;
+   case SCIP_EVENTTYPE_LPSOLVED:
+      /* interrupt solution process of sub-SCIP */
+      if( SCIPgetNLPs(scip) > eventdata->lplimfac * eventdata->nodelimit )
+      {
+         SCIPdebugMsg(scip, "interrupt after  %" SCIP_LONGINT_FORMAT " LPs\n", SCIPgetNLPs(scip));
+         SCIP_CALL( SCIPinterruptSolve(scip) );
+      }
+      break;
+   default:
+      break;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** event handler execution method for the sub-SCIPs of a parallel call
+ *
+ *  This is called in the worker threads. Solutions are only transferred after all sub-SCIPs have finished, but the
+ *  objective value of the best solution is passed on to the other sub-SCIPs as objective limit.
+ */
+static
+SCIP_DECL_EVENTEXEC(eventExecAlnsParallel)
+{
+   ALNSSHARED* shared;
+   SCIP_Real bestobj;
+
+   assert(eventhdlr != NULL);
+   assert(eventdata != NULL);
+   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
+   assert(event != NULL);
+   assert(SCIPeventGetType(event) & SCIP_EVENTTYPE_ALNSPARALLEL);
+
+   shared = eventdata->shared;
+
+   switch( SCIPeventGetType(event) )
+   {
+   case SCIP_EVENTTYPE_BESTSOLFOUND:
+      /* publish the objective value of the new best solution; this is only done if all sub-SCIPs share the objective */
+      if( shared != NULL )
+      {
+         bestobj = SCIPgetSolOrigObj(scip, SCIPgetBestSol(scip));
+
+         SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+         shared->bestobj = MIN(shared->bestobj, bestobj);
+         SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+      }
+      break;
+   case SCIP_EVENTTYPE_NODESOLVED:
+      /* only look for solutions that are better than the ones found by the other sub-SCIPs */
+      if( shared != NULL )
+      {
+         SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+         bestobj = shared->bestobj;
+         SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+
+         if( SCIPisLT(scip, bestobj, SCIPgetObjlimit(scip)) )
+         {
+            SCIPdebugMsg(scip, "tighten objective limit to %g found by another sub-SCIP\n", bestobj);
+            SCIP_CALL( SCIPsetObjlimit(scip, bestobj) );
+         }
+      }
       break;
    case SCIP_EVENTTYPE_LPSOLVED:
       /* interrupt solution process of sub-SCIP */
@@ -2065,6 +2153,122 @@ SCIP_RETCODE selectNeighborhood(
    return SCIP_OKAY;
 }
 
+/** orders all active neighborhoods for a parallel call, such that the first ones should be solved
+ *
+ *  The first neighborhood is selected by the bandit algorithm as in a sequential call. The bandit algorithm is only
+ *  updated after all neighborhoods of a parallel call have been solved, so that selecting it repeatedly would mostly
+ *  return the same neighborhood. Therefore, the remaining neighborhoods are drawn without replacement: proportionally to
+ *  their selection probabilities for the Exp.3 variants, and by decreasing score for UCB and epsilon-greedy, where ties
+ *  are broken randomly.
+ */
+static
+SCIP_RETCODE selectNeighborhoods(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data of the ALNS neighborhood */
+   int*                  neighborhoodidxs    /**< array to store the nactiveneighborhoods ordered neighborhood indices */
+   )
+{
+   SCIP_BANDIT* bandit;
+   SCIP_RANDNUMGEN* rng;
+   SCIP_Real scores[NNEIGHBORHOODS];
+   SCIP_Bool selected[NNEIGHBORHOODS];
+   SCIP_Bool sample;
+   int nactions;
+   int nselected;
+   int i;
+
+   assert(scip != NULL);
+   assert(heurdata != NULL);
+   assert(neighborhoodidxs != NULL);
+
+   nactions = heurdata->nactiveneighborhoods;
+   assert(nactions > 0);
+
+   bandit = getBandit(heurdata);
+   rng = SCIPbanditGetRandnumgen(bandit);
+   assert(rng != NULL);
+
+   SCIP_CALL( selectNeighborhood(scip, heurdata, &neighborhoodidxs[0]) );
+   assert(neighborhoodidxs[0] < nactions);
+
+   BMSclearMemoryArray(selected, NNEIGHBORHOODS);
+   selected[neighborhoodidxs[0]] = TRUE;
+
+   sample = (heurdata->banditalgo == 'e' || heurdata->banditalgo == 'i');
+
+   for( i = 0; i < nactions; ++i )
+   {
+      switch( heurdata->banditalgo )
+      {
+      case 'u':
+         scores[i] = SCIPgetConfidenceBoundUcb(bandit, i);
+         break;
+      case 'g':
+         scores[i] = SCIPgetWeightsEpsgreedy(bandit)[i];
+         break;
+      case 'e':
+         scores[i] = SCIPgetProbabilityExp3(bandit, i);
+         break;
+      case 'i':
+         scores[i] = SCIPgetProbabilityExp3IX(bandit, i);
+         break;
+      default:
+         SCIPerrorMessage("Unknown bandit parameter %c\n", heurdata->banditalgo);
+         return SCIP_INVALIDDATA;
+      }
+
+      /* break ties randomly */
+      if( ! sample )
+         scores[i] += SCIPrandomGetReal(rng, 0.0, 1e-6);
+   }
+
+   for( nselected = 1; nselected < nactions; ++nselected )
+   {
+      SCIP_Real total;
+      SCIP_Real r;
+      int best;
+
+      best = -1;
+
+      if( sample )
+      {
+         total = 0.0;
+         for( i = 0; i < nactions; ++i )
+         {
+            if( ! selected[i] )
+               total += scores[i];
+         }
+
+         r = SCIPrandomGetReal(rng, 0.0, total);
+         for( i = 0; i < nactions; ++i )
+         {
+            if( selected[i] )
+               continue;
+
+            /* the last unselected neighborhood is taken if rounding errors prevent the draw from hitting one */
+            best = i;
+            r -= scores[i];
+            if( r <= 0.0 )
+               break;
+         }
+      }
+      else
+      {
+         for( i = 0; i < nactions; ++i )
+         {
+            if( ! selected[i] && (best == -1 || scores[i] > scores[best]) )
+               best = i;
+         }
+      }
+      assert(best >= 0);
+
+      neighborhoodidxs[nselected] = best;
+      selected[best] = TRUE;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** Calculate reward based on the selected reward measure */
 static
 SCIP_RETCODE getReward(
@@ -2320,6 +2524,326 @@ SCIP_RETCODE setupSubScip(
    return SCIP_OKAY;
 }
 
+/** presolves and solves the sub-SCIP of a neighborhood; this is the job function of a parallel ALNS call
+ *
+ *  The job only works on its own sub-SCIP, so that several jobs can run concurrently. Solutions are transferred to the
+ *  main SCIP after all jobs have finished. The solving time is measured by a clock of the sub-SCIP, such that each
+ *  neighborhood is only charged with the time of its own job.
+ */
+static
+SCIP_RETCODE solveSubscipJob(
+   void*                 args                /**< the ALNS job */
+   )
+{
+   ALNSJOB* job;
+   SCIP_Real allfixingrate;
+   SCIP_RETCODE retcode;
+
+   job = (ALNSJOB*) args;
+   assert(job != NULL);
+   assert(job->subscip != NULL);
+
+   SCIP_CALL( SCIPstartClock(job->subscip, job->clock) );
+
+   retcode = SCIPpresolve(job->subscip);
+   if( retcode != SCIP_OKAY )
+   {
+      SCIP_CALL( SCIPstopClock(job->subscip, job->clock) );
+      return retcode;
+   }
+
+   /* was presolving successful enough regarding fixings? otherwise, terminate */
+   allfixingrate = (SCIPgetNOrigVars(job->subscip) - SCIPgetNVars(job->subscip)) / (SCIP_Real)SCIPgetNOrigVars(job->subscip);
+   allfixingrate = MAX(allfixingrate, 0.0);
+
+   if( allfixingrate >= job->targetfixingrate / 2.0 )
+      retcode = SCIPsolve(job->subscip);
+
+   SCIP_CALL( SCIPstopClock(job->subscip, job->clock) );
+
+   return retcode;
+}
+
+/** selects up to heurdata->nparallel distinct neighborhoods, solves their sub-SCIPs concurrently, transfers all found
+ *  solutions into the main SCIP, and updates the bandit algorithm with the rewards of all runs
+ *
+ *  All interaction with the main SCIP happens in the calling thread and in the fixed order of the selected
+ *  neighborhoods; only presolving and solving of the sub-SCIPs is done in parallel. While they are running, the
+ *  sub-SCIPs that share the objective of the main SCIP pass the objective values of their best solutions to each other.
+ */
+static
+SCIP_RETCODE executeParallelNeighborhoods(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< ALNS heuristic */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data of the ALNS heuristic */
+   SOLVELIMITS*          solvelimits,        /**< limits for each sub-SCIP */
+   SCIP_RESULT*          result              /**< pointer to store the result of the heuristic call */
+   )
+{
+   ALNSSHARED shared;
+   ALNSJOB* jobs;
+   void** jobargs;
+   SCIP_VAR** vars;
+   SCIP_VAR** varbuf;
+   SCIP_Real* valbuf;
+   SCIP_RETCODE retcode;
+   int neighborhoodidxs[NNEIGHBORHOODS];
+   SCIP_Bool delayed;
+   int nvars;
+   int njobs;
+   int maxnjobs;
+   int j;
+   int k;
+
+   assert(heurdata->nparallel > 1);
+   assert(heurdata->currneighborhood == -1);
+
+   *result = SCIP_DIDNOTRUN;
+
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varbuf, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &valbuf, nvars) );
+
+   maxnjobs = MIN(heurdata->nparallel, heurdata->nactiveneighborhoods);
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, maxnjobs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, maxnjobs) );
+
+   shared.bestobj = SCIPinfinity(scip);
+   SCIP_CALL( SCIPtpiInitLock(&shared.lock) );
+
+   /* order the neighborhoods and set up the sub-SCIPs of the first ones that can run */
+   SCIP_CALL( selectNeighborhoods(scip, heurdata, neighborhoodidxs) );
+
+   njobs = 0;
+   delayed = FALSE;
+   for( k = 0; k < heurdata->nactiveneighborhoods && njobs < maxnjobs && ! SCIPisStopped(scip); ++k )
+   {
+      SCIP_HASHMAP* varmapf;
+      SCIP_EVENTHDLR* eventhdlr;
+      SCIP_RESULT fixresult;
+      ALNSJOB* job;
+      NH* neighborhood;
+      char probnamesuffix[SCIP_MAXSTRLEN];
+      SCIP_Bool success;
+      int neighborhoodidx;
+      int nfixings;
+      int ndomchgs;
+      int nchgobjs;
+      int naddedconss;
+      int v;
+
+      neighborhoodidx = neighborhoodidxs[k];
+      neighborhood = heurdata->neighborhoods[neighborhoodidx];
+      SCIPdebugMsg(scip, "Setting up '%s' neighborhood %d for parallel solve\n", neighborhood->name, neighborhoodidx);
+
+      SCIP_CALL( SCIPstartClock(scip, neighborhood->stats.setupclock) );
+
+      SCIP_CALL( neighborhoodFixVariables(scip, heurdata, neighborhood, varbuf, valbuf, &nfixings, &fixresult) );
+
+      if( fixresult != SCIP_SUCCESS )
+      {
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+
+         /* as in a sequential call, the first delayed neighborhood is kept and run on its own in the next call, which
+          * is then solved without any other neighborhoods; neighborhoods that cannot run are penalized
+          */
+         if( fixresult == SCIP_DELAYED )
+         {
+            if( heurdata->currneighborhood == -1 )
+            {
+               heurdata->currneighborhood = neighborhoodidx;
+               heurdata->ndelayedcalls = 1;
+            }
+            delayed = TRUE;
+         }
+         else if( fixresult == SCIP_DIDNOTRUN )
+         {
+            SCIP_CALL( updateBanditAlgorithm(scip, heurdata, 0.0, neighborhoodidx) );
+         }
+
+         continue;
+      }
+
+      job = &jobs[njobs];
+      job->neighborhoodidx = neighborhoodidx;
+      job->targetfixingrate = neighborhood->fixingrate.targetfixingrate;
+      initRunStats(scip, &job->runstats);
+      job->runstats.nfixings = nfixings;
+      neighborhood->stats.nfixings += nfixings;
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &job->subvars, nvars) );
+      SCIP_CALL( SCIPcreate(&job->subscip) );
+      SCIP_CALL( SCIPhashmapCreate(&varmapf, SCIPblkmem(scip), nvars) );
+      (void) SCIPsnprintf(probnamesuffix, SCIP_MAXSTRLEN, "alns_%s", neighborhood->name);
+
+      /* the sub-SCIPs are solved concurrently, so they must neither share data with the main SCIP nor with each other
+       * and must not write to the message handler of the main SCIP; this is the copy of
+       * SCIPcopyLargeNeighborhoodSearch() with a thread-safe copy
+       */
+      SCIP_CALL( SCIPcopyConsCompression(scip, job->subscip, varmapf, NULL, probnamesuffix, varbuf, valbuf, nfixings,
+            TRUE, FALSE, TRUE, FALSE, NULL) );
+
+      if( heurdata->copycuts )
+      {
+         SCIP_CALL( SCIPcopyCuts(scip, job->subscip, varmapf, NULL, TRUE, NULL) );
+      }
+
+      SCIP_CALL( SCIPsetRealParam(job->subscip, "limits/primal", SCIP_INVALID) );
+      SCIP_CALL( SCIPsetRealParam(job->subscip, "limits/dual", SCIP_INVALID) );
+
+      for( v = 0; v < nvars; ++v )
+         job->subvars[v] = (SCIP_VAR*)SCIPhashmapGetImage(varmapf, (void *)vars[v]);
+
+      SCIPhashmapFree(&varmapf);
+
+      SCIP_CALL( neighborhoodChangeSubscip(scip, job->subscip, neighborhood, job->subvars, &ndomchgs, &nchgobjs,
+            &naddedconss, &success) );
+
+      if( ! success )
+      {
+         SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+         SCIP_CALL( SCIPfree(&job->subscip) );
+         SCIPfreeBufferArray(scip, &job->subvars);
+         continue;
+      }
+
+      SCIP_CALL( setupSubScip(scip, job->subscip, job->subvars, solvelimits, heur, nchgobjs > 0) );
+
+      job->eventdata.nodelimit = solvelimits->nodelimit;
+      job->eventdata.lplimfac = heurdata->lplimfac;
+      job->eventdata.heur = heur;
+      job->eventdata.sourcescip = scip;
+      job->eventdata.subvars = job->subvars;
+      job->eventdata.runstats = &job->runstats;
+      job->eventdata.allrewardsmode = FALSE;
+
+      /* objective values can only be compared between sub-SCIPs that keep the objective of the main SCIP */
+      job->eventdata.shared = nchgobjs > 0 ? NULL : &shared;
+
+      /* solutions must not be transferred from the worker threads, so they are collected after all jobs finished */
+      SCIP_CALL( SCIPincludeEventhdlrBasic(job->subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC,
+            eventExecAlnsParallel, NULL) );
+      SCIP_CALL( SCIPtransformProb(job->subscip) );
+      SCIP_CALL( SCIPcatchEvent(job->subscip, SCIP_EVENTTYPE_ALNSPARALLEL, eventhdlr, &job->eventdata, NULL) );
+
+      SCIP_CALL( SCIPcreateWallClock(job->subscip, &job->clock) );
+
+      SCIP_CALL( SCIPstopClock(scip, neighborhood->stats.setupclock) );
+
+      jobargs[njobs] = (void*) job;
+      ++njobs;
+   }
+
+   SCIPdebugMsg(scip, "Solving %d neighborhoods in parallel\n", njobs);
+
+   if( njobs == 0 )
+      goto TERMINATE;
+
+   *result = SCIP_DIDNOTFIND;
+
+   /* the sub-SCIPs run at the same time, so they have to share the remaining memory */
+   for( j = 0; j < njobs && njobs > 1; ++j )
+   {
+      SCIP_Real memorylimit;
+
+      SCIP_CALL( SCIPgetRealParam(jobs[j].subscip, "limits/memory", &memorylimit) );
+
+      if( ! SCIPisInfinity(scip, memorylimit) )
+      {
+         SCIP_CALL( SCIPsetRealParam(jobs[j].subscip, "limits/memory", memorylimit / njobs) );
+      }
+   }
+
+   retcode = SCIPtpiExecuteJobs(solveSubscipJob, jobargs, njobs, heurdata->nparallel);
+
+   /* charge each neighborhood with the solving time of its own job */
+   for( j = 0; j < njobs; ++j )
+   {
+      SCIP_CLOCK* submipclock;
+
+      submipclock = heurdata->neighborhoods[jobs[j].neighborhoodidx]->stats.submipclock;
+      SCIP_CALL( SCIPsetClockTime(scip, submipclock,
+            SCIPgetClockTime(scip, submipclock) + SCIPgetClockTime(jobs[j].subscip, jobs[j].clock)) );
+   }
+
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPwarningMessage(scip, "Error while solving subproblems in parallel ALNS heuristic; sub-SCIP terminated with code <%d>\n", retcode);
+      SCIPABORT();  /*lint --e{527}*/
+      goto TERMINATE;
+   }
+
+   /* transfer solutions, collect rewards, and update statistics in the order of the selected neighborhoods */
+   for( j = 0; j < njobs; ++j )
+   {
+      ALNSJOB* job;
+      NH* neighborhood;
+      SCIP_SOL** subsols;
+      SCIP_STATUS subscipstatus;
+      SCIP_Real rewards[NREWARDTYPES];
+      int nsubsols;
+      int s;
+
+      job = &jobs[j];
+      neighborhood = heurdata->neighborhoods[job->neighborhoodidx];
+
+      /* solutions are added from the worst to the best one, which mimics the order in which they were found */
+      subsols = SCIPgetSols(job->subscip);
+      nsubsols = SCIPgetNSols(job->subscip);
+      for( s = nsubsols - 1; s >= 0; --s )
+      {
+         SCIP_CALL( transferSolution(job->subscip, subsols[s], &job->eventdata) );
+      }
+
+      updateRunStats(&job->runstats, job->subscip);
+      subscipstatus = SCIPgetStatus(job->subscip);
+
+      SCIP_CALL( getReward(scip, heurdata, &job->runstats, rewards) );
+
+      if( neighborhood->stats.nruns == 0 )
+         --heurdata->ninitneighborhoods;
+
+      heurdata->usednodes += job->runstats.usednodes;
+
+      updateNeighborhoodStats(&job->runstats, neighborhood, subscipstatus);
+
+      if( heurdata->adjustfixingrate )
+         updateFixingRate(neighborhood, subscipstatus, &job->runstats);
+
+      if( heurdata->adjustminimprove )
+         updateMinimumImprovement(heurdata, subscipstatus, &job->runstats);
+
+      if( heurdata->adjusttargetnodes && SCIPheurGetNCalls(heur) >= heurdata->nactiveneighborhoods )
+         updateTargetNodeLimit(heurdata, &job->runstats, subscipstatus);
+
+      SCIP_CALL( updateBanditAlgorithm(scip, heurdata, rewards[REWARDTYPE_TOTAL], job->neighborhoodidx) );
+
+      if( job->runstats.nbestsolsfound > 0 )
+         *result = SCIP_FOUNDSOL;
+   }
+
+TERMINATE:
+   for( j = njobs - 1; j >= 0; --j )
+   {
+      SCIP_CALL( SCIPfreeClock(jobs[j].subscip, &jobs[j].clock) );
+      SCIP_CALL( SCIPfree(&jobs[j].subscip) );
+      SCIPfreeBufferArray(scip, &jobs[j].subvars);
+   }
+
+   SCIPtpiDestroyLock(&shared.lock);
+
+   SCIPfreeBufferArray(scip, &jobargs);
+   SCIPfreeBufferArray(scip, &jobs);
+   SCIPfreeBufferArray(scip, &valbuf);
+   SCIPfreeBufferArray(scip, &varbuf);
+
+   /* the heuristic is called again soon for the delayed neighborhood, unless it found a solution in this call */
+   if( delayed && *result != SCIP_FOUNDSOL )
+      *result = SCIP_DELAYED;
+
+   return SCIP_OKAY;
+}
+
 /** execution method of primal heuristic */
 static
 SCIP_DECL_HEUREXEC(heurExecAlns)
@@ -2428,6 +2952,14 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       }
    }
 
+   /* solve several neighborhoods concurrently if requested; a delayed neighborhood is first run on its own */
+   if( heurdata->nparallel > 1 && ! allrewardsmode && heurdata->currneighborhood == -1 && SCIPtpiIsAvailable() )
+   {
+      SCIP_CALL( executeParallelNeighborhoods(scip, heur, heurdata, &solvelimits, result) );
+
+      return SCIP_OKAY;
+   }
+
    /* use the neighborhood that requested a delay or select the next neighborhood to run based on the selected bandit algorithm */
    if( heurdata->currneighborhood >= 0 )
    {
@@ -2604,6 +3136,7 @@ SCIP_DECL_HEUREXEC(heurExecAlns)
       eventdata.subvars = subvars;
       eventdata.runstats = &runstats[neighborhoodidx];
       eventdata.allrewardsmode = allrewardsmode;
+      eventdata.shared = NULL;
 
       /* include an event handler to transfer solutions into the main SCIP */
       SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecAlns, NULL) );
@@ -4192,6 +4725,10 @@ SCIP_RETCODE SCIPincludeHeurAlns(
          "should the heuristic be executed multiple times during the root node?",
          &heurdata->initduringroot, TRUE, DEFAULT_INITDURINGROOT, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nparallel",
+         "number of neighborhoods that are solved concurrently on separate threads in one call (1: sequential)",
+         &heurdata->nparallel, TRUE, DEFAULT_NPARALLEL, 1, 64, NULL, NULL) );
+
    assert(SCIPfindTable(scip, TABLE_NAME_NEIGHBORHOOD) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_NEIGHBORHOOD, TABLE_DESC_NEIGHBORHOOD, TRUE,
          NULL, NULL, NULL, NULL, NULL, NULL, tableOutputNeighborhood,
@@ -0,0 +1,543 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_async.c
+ * @ingroup DEFPLUGINS_HEUR
+ * @brief  asynchronous execution of primal heuristics on a copy of the problem in a background thread
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/heur_async.h"
+#include "scip/pub_event.h"
+#include "scip/pub_heur.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/scip_copy.h"
+#include "scip/scip_event.h"
+#include "scip/scip_general.h"
+#include "scip/scip_heur.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_param.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_sol.h"
+#include "scip/scip_solve.h"
+#include "scip/scip_solvingstats.h"
+#include "tpi/tpi.h"
+#include <string.h>
+
+#define HEUR_NAME             "async"
+#define HEUR_DESC             "executes asynchronous primal heuristics on a copy of the problem in a background thread"
+#define HEUR_DISPCHAR         SCIP_HEURDISPCHAR_LNS
+#define HEUR_PRIORITY         -1100000
+#define HEUR_FREQ             -1
+#define HEUR_FREQOFS          0
+#define HEUR_MAXDEPTH         -1
+#define HEUR_TIMING           SCIP_HEURTIMING_AFTERNODE
+#define HEUR_USESSUBSCIP      TRUE  /**< does the heuristic use a secondary SCIP instance? */
+
+/* event handler properties */
+#define EVENTHDLR_NAME         "Async"
+#define EVENTHDLR_DESC         "node event handler for " HEUR_NAME " heuristic"
+
+#define DEFAULT_MAXNODES      500LL     /**< maximum number of nodes to regard in the copy of the problem */
+#define DEFAULT_NSOLS         10        /**< number of best solutions that are passed to the copy of the problem */
+#define DEFAULT_NWAITINGNODES 100LL     /**< number of nodes after which a new copy is created even if the incumbent has
+                                         *   not changed */
+
+/*
+ * Data structures
+ */
+
+/** primal heuristic data */
+struct SCIP_HeurData
+{
+   SCIP*                 subscip;            /**< copy of the problem that is solved by the worker, or NULL */
+   SCIP_VAR**            subvars;            /**< copies of the problem variables in subscip */
+   SCIP_JOBBATCH*        jobbatch;           /**< job of the worker, or NULL if no worker is running */
+   SCIP_LOCK*            lock;               /**< lock to protect the interrupt flag */
+   SCIP_Longint          maxnodes;           /**< maximum number of nodes to regard in the copy of the problem */
+   SCIP_Longint          nwaitingnodes;      /**< number of nodes after which a new copy is created even if the incumbent
+                                              *   has not changed */
+   SCIP_Longint          lastnbestsols;      /**< number of best solutions found when the last copy was created */
+   SCIP_Longint          lastnnodes;         /**< number of nodes processed when the last copy was created */
+   int                   nsubvars;           /**< number of problem variables when the copy was created */
+   int                   nsols;              /**< number of best solutions that are passed to the copy of the problem */
+   int                   nruns;              /**< number of copies that have been created in this run */
+   SCIP_Bool             delegating;         /**< are the asynchronous heuristics delegated to the worker? */
+   SCIP_Bool             interrupt;          /**< should the worker stop solving the copy? */
+};
+
+
+/*
+ * Local methods
+ */
+
+/* ---------------- Callback methods of event handler ---------------- */
+
+/* exec the event handler
+ *
+ * we interrupt the solution process of the copy if the worker has been stopped; this is called in the worker thread
+ */
+static
+SCIP_DECL_EVENTEXEC(eventExecAsync)
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_Bool interrupt;
+
+   assert(eventhdlr != NULL);
+   assert(eventdata != NULL);
+   assert(strcmp(SCIPeventhdlrGetName(eventhdlr), EVENTHDLR_NAME) == 0);
+   assert(event != NULL);
+   assert(SCIPeventGetType(event) & SCIP_EVENTTYPE_NODESOLVED);
+
+   heurdata = (SCIP_HEURDATA*)eventdata;
+   assert(heurdata != NULL);
+
+   SCIP_CALL( SCIPtpiAcquireLock(heurdata->lock) );
+   interrupt = heurdata->interrupt;
+   SCIP_CALL( SCIPtpiReleaseLock(heurdata->lock) );
+
+   if( interrupt )
+   {
+      SCIP_CALL( SCIPinterruptSolve(scip) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** job that solves the copy of the problem in a separate thread */
+static
+SCIP_RETCODE solveSnapshot(
+   void*                 args                /**< copy of the problem stored inside a void pointer */
+   )
+{
+   SCIP* subscip;
+
+   subscip = (SCIP*) args;
+   assert(subscip != NULL);
+
+   SCIP_CALL( SCIPsolve(subscip) );
+
+   return SCIP_OKAY;
+}
+
+/** creates a copy of the problem with the current global bounds and the best solutions and starts the worker on it */
+static
+SCIP_RETCODE startSnapshot(
+   SCIP*                 scip,               /**< original SCIP data structure */
+   SCIP_HEURDATA*        heurdata            /**< heuristic's private data structure */
+   )
+{
+   char paramname[SCIP_MAXSTRLEN];
+   SCIP* subscip;
+   SCIP_HASHMAP* varmapfw;
+   SCIP_EVENTHDLR* eventhdlr;
+   SCIP_HEUR** subheurs;
+   SCIP_VAR** vars;
+   SCIP_SOL** sols;
+   SCIP_Bool valid;
+   int nsubheurs;
+   int nvars;
+   int nsols;
+   int i;
+   int j;
+
+   assert(heurdata != NULL);
+   assert(heurdata->subscip == NULL);
+   assert(heurdata->jobbatch == NULL);
+
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+
+   SCIP_CALL( SCIPcreate(&heurdata->subscip) );
+   subscip = heurdata->subscip;
+
+   /* copy the problem with the current global bounds; the copy is solved in parallel, so it has to be thread safe */
+   SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(subscip), nvars) );
+   SCIP_CALL( SCIPcopy(scip, subscip, varmapfw, NULL, HEUR_NAME, TRUE, FALSE, TRUE, FALSE, &valid) );
+   SCIPdebugMsg(scip, "Copying the SCIP instance was %s complete.\n", valid ? "" : "not ");
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &heurdata->subvars, nvars) );
+   heurdata->nsubvars = nvars;
+   for( i = 0; i < nvars; ++i )
+      heurdata->subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmapfw, vars[i]);
+
+   SCIPhashmapFree(&varmapfw);
+
+   /* create event handler that interrupts the copy when the worker is stopped */
+   eventhdlr = NULL;
+   SCIP_CALL( SCIPincludeEventhdlrBasic(subscip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecAsync, NULL) );
+   if( eventhdlr == NULL )
+   {
+      SCIPerrorMessage("event handler for " HEUR_NAME " heuristic not found.\n");
+      return SCIP_PLUGINNOTFOUND;
+   }
+
+   /* do not abort subproblem on CTRL-C and disable output */
+   SCIP_CALL( SCIPsetBoolParam(subscip, "misc/catchctrlc", FALSE) );
+   SCIP_CALL( SCIPsetIntParam(subscip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetBoolParam(subscip, "timing/statistictiming", FALSE) );
+
+   /* set limits for the subproblem */
+   SCIP_CALL( SCIPcopyLimits(scip, subscip) );
+   SCIP_CALL( SCIPsetLongintParam(subscip, "limits/nodes", heurdata->maxnodes) );
+
+   /* only the asynchronous heuristics are executed in the copy; this also disables this heuristic in the copy */
+   subheurs = SCIPgetHeurs(subscip);
+   nsubheurs = SCIPgetNHeurs(subscip);
+   for( i = 0; i < nsubheurs; ++i )
+   {
+      if( SCIPheurIsAsync(subheurs[i]) )
+         continue;
+
+      (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "heuristics/%s/freq", SCIPheurGetName(subheurs[i]));
+      if( !SCIPisParamFixed(subscip, paramname) )
+      {
+         SCIP_CALL( SCIPsetIntParam(subscip, paramname, -1) );
+      }
+   }
+
+   /* the copy only serves to find primal solutions */
+   SCIP_CALL( SCIPsetSeparating(subscip, SCIP_PARAMSETTING_FAST, TRUE) );
+   SCIP_CALL( SCIPsetPresolving(subscip, SCIP_PARAMSETTING_FAST, TRUE) );
+
+   /* pass the best solutions to the copy, such that improvement heuristics can work on them */
+   nsols = MIN(SCIPgetNSols(scip), heurdata->nsols);
+   sols = SCIPgetSols(scip);
+   for( i = 0; i < nsols; ++i )
+   {
+      SCIP_SOL* subsol;
+      SCIP_Bool success;
+
+      SCIP_CALL( SCIPcreateOrigSol(subscip, &subsol, NULL) );
+      for( j = 0; j < nvars; ++j )
+      {
+         if( heurdata->subvars[j] != NULL )
+         {
+            SCIP_CALL( SCIPsetSolVal(subscip, subsol, heurdata->subvars[j], SCIPgetSolVal(scip, sols[i], vars[j])) );
+         }
+      }
+      SCIP_CALL( SCIPaddSolFree(subscip, &subsol, &success) );
+   }
+
+   SCIP_CALL( SCIPtransformProb(subscip) );
+   SCIP_CALL( SCIPcatchEvent(subscip, SCIP_EVENTTYPE_NODESOLVED, eventhdlr, (SCIP_EVENTDATA*) heurdata, NULL) );
+
+   heurdata->interrupt = FALSE;
+   heurdata->lastnbestsols = SCIPgetNBestSolsFound(scip);
+   heurdata->lastnnodes = SCIPgetNNodes(scip);
+   ++heurdata->nruns;
+
+   SCIPdebugMsg(scip, "starting worker on copy %d with %d solutions\n", heurdata->nruns, nsols);
+
+   SCIP_CALL( SCIPtpiStartJobs(solveSnapshot, (void**) &heurdata->subscip, 1, 1, &heurdata->jobbatch) );
+
+   return SCIP_OKAY;
+}
+
+/** waits for the worker, transfers the solutions of the copy if requested, and frees the copy */
+static
+SCIP_RETCODE finishSnapshot(
+   SCIP*                 scip,               /**< original SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the heuristic */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic's private data structure */
+   SCIP_Bool             transfer,           /**< should the solutions of the copy be transferred? */
+   SCIP_RESULT*          result              /**< pointer to update the result, or NULL */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   assert(heurdata != NULL);
+   assert(heurdata->subscip != NULL);
+   assert(heurdata->jobbatch != NULL);
+
+   /* errors in solving the copy should not kill the overall solving process; only in debug mode, SCIP will stop */
+   retcode = SCIPtpiWaitJobs(&heurdata->jobbatch);
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPwarningMessage(scip, "Error while solving the copy of the " HEUR_NAME " heuristic: %d\n", retcode);
+      SCIPABORT();
+      transfer = FALSE;
+   }
+
+   /* variables may have been added to the problem in the meantime, in which case the solutions cannot be translated */
+   if( transfer && SCIPgetNVars(scip) == heurdata->nsubvars )
+   {
+      SCIP_SOL** subsols;
+      int nsubsols;
+      int i;
+
+      assert(result != NULL);
+
+      nsubsols = SCIPgetNSols(heurdata->subscip);
+      subsols = SCIPgetSols(heurdata->subscip);
+
+      SCIPdebugMsg(scip, "worker on copy %d finished with %d solutions\n", heurdata->nruns, nsubsols);
+
+      for( i = 0; i < nsubsols; ++i )
+      {
+         SCIP_SOL* newsol;
+         SCIP_Bool success;
+
+         SCIP_CALL( SCIPtranslateSubSol(scip, heurdata->subscip, subsols[i], heur, heurdata->subvars, &newsol) );
+         SCIP_CALL( SCIPtrySolFree(scip, &newsol, FALSE, FALSE, TRUE, TRUE, TRUE, &success) );
+         if( success )
+            *result = SCIP_FOUNDSOL;
+      }
+   }
+
+   SCIPfreeBlockMemoryArray(scip, &heurdata->subvars, heurdata->nsubvars);
+   SCIP_CALL( SCIPfree(&heurdata->subscip) );
+   heurdata->nsubvars = 0;
+
+   return SCIP_OKAY;
+}
+
+/* ---------------- Callback methods of primal heuristic ---------------- */
+
+/** copy method for primal heuristic plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_HEURCOPY(heurCopyAsync)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(heur != NULL);
+   assert(strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0);
+
+   /* call inclusion method of primal heuristic */
+   SCIP_CALL( SCIPincludeHeurAsync(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** destructor of primal heuristic to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_HEURFREE(heurFreeAsync)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(heur != NULL);
+   assert(scip != NULL);
+
+   /* get heuristic data */
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+   assert(heurdata->subscip == NULL);
+
+   /* free heuristic data */
+   SCIPfreeBlockMemory(scip, &heurdata);
+   SCIPheurSetData(heur, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** solving process initialization method of primal heuristic (called when branch and bound process is about to begin) */
+static
+SCIP_DECL_HEURINITSOL(heurInitsolAsync)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+   SCIP_HEUR** heurs;
+   int nheurs;
+   int i;
+
+   assert(heur != NULL);
+   assert(scip != NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+   assert(heurdata->subscip == NULL);
+   assert(heurdata->jobbatch == NULL);
+
+   heurdata->nruns = 0;
+   heurdata->lastnbestsols = 0;
+   heurdata->lastnnodes = 0;
+   heurdata->delegating = FALSE;
+
+   /* the asynchronous heuristics are executed at the nodes as usual if this heuristic is not called regularly to collect
+    * the solutions of the worker, or if the worker would block the calling thread
+    */
+   if( SCIPheurGetFreq(heur) <= 0 || !SCIPtpiIsAvailable() || !SCIPtpiCanStartJobs() )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPtpiInitLock(&heurdata->lock) );
+
+   heurs = SCIPgetHeurs(scip);
+   nheurs = SCIPgetNHeurs(scip);
+   for( i = 0; i < nheurs; ++i )
+   {
+      if( SCIPheurIsAsync(heurs[i]) )
+         SCIPheurSetDelegated(heurs[i], TRUE);
+   }
+   heurdata->delegating = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** solving process deinitialization method of primal heuristic (called before branch and bound process data is freed) */
+static
+SCIP_DECL_HEUREXITSOL(heurExitsolAsync)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+   SCIP_HEUR** heurs;
+   int nheurs;
+   int i;
+
+   assert(heur != NULL);
+   assert(scip != NULL);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   if( !heurdata->delegating )
+      return SCIP_OKAY;
+
+   /* stop a running worker and discard its solutions */
+   if( heurdata->jobbatch != NULL )
+   {
+      SCIP_CALL( SCIPtpiAcquireLock(heurdata->lock) );
+      heurdata->interrupt = TRUE;
+      SCIP_CALL( SCIPtpiReleaseLock(heurdata->lock) );
+
+      SCIP_CALL( finishSnapshot(scip, heur, heurdata, FALSE, NULL) );
+   }
+
+   heurs = SCIPgetHeurs(scip);
+   nheurs = SCIPgetNHeurs(scip);
+   for( i = 0; i < nheurs; ++i )
+      SCIPheurSetDelegated(heurs[i], FALSE);
+   heurdata->delegating = FALSE;
+
+   SCIPtpiDestroyLock(&heurdata->lock);
+
+   return SCIP_OKAY;
+}
+
+/** execution method of primal heuristic */
+static
+SCIP_DECL_HEUREXEC(heurExecAsync)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+   SCIP_Bool success;
+
+   assert(heur != NULL);
+   assert(scip != NULL);
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   if( !heurdata->delegating )
+      return SCIP_OKAY;
+
+   /* collect the solutions of a finished worker; a running worker is left alone */
+   if( heurdata->jobbatch != NULL )
+   {
+      if( !SCIPtpiJobsFinished(heurdata->jobbatch) )
+         return SCIP_OKAY;
+
+      *result = SCIP_DIDNOTFIND;
+      SCIP_CALL( finishSnapshot(scip, heur, heurdata, TRUE, result) );
+   }
+
+   /* a new copy pays off if the incumbent has changed since the last one was created, or if the tree search has
+    * progressed far enough that the global bounds are likely to be tighter
+    */
+   if( heurdata->nruns > 0 && SCIPgetNBestSolsFound(scip) == heurdata->lastnbestsols
+      && SCIPgetNNodes(scip) - heurdata->lastnnodes < heurdata->nwaitingnodes )
+      return SCIP_OKAY;
+
+   if( SCIPisStopped(scip) )
+      return SCIP_OKAY;
+
+   /* check whether there is enough time and memory left */
+   SCIP_CALL( SCIPcheckCopyLimits(scip, &success) );
+
+   if( !success )
+      return SCIP_OKAY;
+
+   SCIP_CALL( startSnapshot(scip, heurdata) );
+
+   if( *result == SCIP_DIDNOTRUN )
+      *result = SCIP_DIDNOTFIND;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * primal heuristic specific interface methods
+ */
+
+/** creates the async primal heuristic and includes it in SCIP */
+SCIP_RETCODE SCIPincludeHeurAsync(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_HEUR* heur;
+
+   /* create heuristic data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
+   heurdata->subscip = NULL;
+   heurdata->subvars = NULL;
+   heurdata->jobbatch = NULL;
+   heurdata->lock = NULL;
+   heurdata->nsubvars = 0;
+   heurdata->nruns = 0;
+   heurdata->lastnbestsols = 0;
+   heurdata->lastnnodes = 0;
+   heurdata->delegating = FALSE;
+   heurdata->interrupt = FALSE;
+
+   /* include primal heuristic */
+   heur = NULL;
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur,
+         HEUR_NAME, HEUR_DESC, HEUR_DISPCHAR, HEUR_PRIORITY, HEUR_FREQ, HEUR_FREQOFS,
+         HEUR_MAXDEPTH, HEUR_TIMING, HEUR_USESSUBSCIP, heurExecAsync, heurdata) );
+   assert(heur != NULL);
+
+   /* set non-NULL pointers to callback methods */
+   SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopyAsync) );
+   SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeAsync) );
+   SCIP_CALL( SCIPsetHeurInitsol(scip, heur, heurInitsolAsync) );
+   SCIP_CALL( SCIPsetHeurExitsol(scip, heur, heurExitsolAsync) );
+
+   /* add async primal heuristic parameters */
+   SCIP_CALL( SCIPaddLongintParam(scip, "heuristics/" HEUR_NAME "/maxnodes",
+         "maximum number of nodes to regard in the copy of the problem",
+         &heurdata->maxnodes, TRUE, DEFAULT_MAXNODES, 0LL, SCIP_LONGINT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nsols",
+         "number of best solutions that are passed to the copy of the problem",
+         &heurdata->nsols, TRUE, DEFAULT_NSOLS, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddLongintParam(scip, "heuristics/" HEUR_NAME "/nwaitingnodes",
+         "number of nodes after which a new copy is created even if the incumbent has not changed",
+         &heurdata->nwaitingnodes, TRUE, DEFAULT_NWAITINGNODES, 0LL, SCIP_LONGINT_MAX, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,74 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_async.h
+ * @ingroup PRIMALHEURISTICS
+ * @brief  asynchronous execution of primal heuristics on a copy of the problem in a background thread
+ *
+ * The async heuristic takes a snapshot of the problem, i.e., a copy with the current global bounds together with the
+ * best solutions found so far, and solves this copy with a small node limit in a separate thread. In the copy, only
+ * the primal heuristics that are marked as asynchronous (see SCIPheurSetAsync()) are active. While the async heuristic
+ * is active, these heuristics are not executed at the nodes of the main search tree anymore, such that expensive
+ * large neighborhood searches do not stall the tree search.
+ *
+ * At each call, the async heuristic checks whether the worker has finished. In this case, the solutions found in the
+ * copy are transferred to the main problem and a new snapshot is started if the incumbent has changed in the
+ * meantime or enough nodes have been processed since the last snapshot.
+ *
+ * The LP solution of the current node is not passed to the copy. Heuristics like RINS that use an LP solution
+ * therefore work with the LP solutions of the copy, which are computed over the global bounds of the snapshot.
+ *
+ * The heuristic is disabled by default. It only delegates the asynchronous heuristics if it is called regularly
+ * (heuristics/async/freq > 0) and the task processing interface can run jobs in the background (see
+ * SCIPtpiCanStartJobs()). Since the worker runs concurrently to the tree search, the solving process is not
+ * deterministic when it is enabled.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_HEUR_ASYNC_H__
+#define __SCIP_HEUR_ASYNC_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the async primal heuristic and includes it in SCIP
+ *
+ *  @ingroup PrimalHeuristicIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeHeurAsync(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
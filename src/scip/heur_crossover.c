@@ -79,6 +79,9 @@
 #define DEFAULT_NUSEDSOLS     3              /* number of solutions that will be taken into account                   */
 #define DEFAULT_NWAITINGNODES 200LL          /* number of nodes without incumbent change heuristic should wait        */
 #define DEFAULT_RANDOMIZATION TRUE           /* should the choice which sols to take be randomized?                   */
+#define DEFAULT_DIVERSIFY     FALSE          /* should the used solutions differ as much as possible instead of being
+                                              * the best ones? */
+#define DIVERSIFYPOOLFACTOR   3              /* diverse solutions are chosen among the best (factor * nusedsols) ones  */
 #define DEFAULT_DONTWAITATROOT FALSE         /* should the nwaitingnodes parameter be ignored at the root node?       */
 #define DEFAULT_USELPROWS     FALSE          /* should subproblem be created out of the rows in the LP rows,
                                               * otherwise, the copy constructors of the constraints handlers are used */
@@ -123,6 +126,7 @@ struct SCIP_HeurData
    SCIP_Real             nodelimit;          /**< the nodelimit employed in the current sub-SCIP, for the event handler*/
    SCIP_Real             lplimfac;           /**< factor by which the limit on the number of LP depends on the node limit */
    SCIP_Bool             randomization;      /**< should the choice which sols to take be randomized?               */
+   SCIP_Bool             diversify;          /**< should the used solutions differ as much as possible instead of being the best ones? */
    SCIP_Bool             dontwaitatroot;     /**< should the nwaitingnodes parameter be ignored at the root node?   */
    SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator                                           */
    SCIP_HASHTABLE*       hashtable;          /**< hashtable used to store the solution tuples already used          */
@@ -470,12 +474,21 @@ SCIP_RETCODE determineVariableFixings(
       SCIP_Longint solnodenum;
       SCIP_Bool allsame;
 
-      for( i = 0; i < nusedsols; i++ )
-         selection[i] = i;
+      /* either take the best solutions or the most diverse ones among the best solutions, starting with the incumbent */
+      if( heurdata->diversify && nsols > nusedsols )
+      {
+         SCIP_CALL( SCIPselectDiverseSols(scip, sols, MIN(nsols, DIVERSIFYPOOLFACTOR * nusedsols), nusedsols, selection) );
+         SCIPsortInt(selection, nusedsols);
+      }
+      else
+      {
+         for( i = 0; i < nusedsols; i++ )
+            selection[i] = i;
+      }
       SCIP_CALL( createSolTuple(scip, &elem, selection, nusedsols, heurdata) );
 
-      solheur = SCIPsolGetHeur(sols[0]);
-      solnodenum = SCIPsolGetNodenum(sols[0]);
+      solheur = SCIPsolGetHeur(sols[selection[0]]);
+      solnodenum = SCIPsolGetNodenum(sols[selection[0]]);
       allsame = TRUE;
 
       /* check, whether all solutions have been found by the same heuristic at the same node; in this case we do not run
@@ -483,7 +496,7 @@ SCIP_RETCODE determineVariableFixings(
        */
       for( i = 1; i < nusedsols; i++ )
       {
-         if( SCIPsolGetHeur(sols[i]) != solheur || SCIPsolGetNodenum(sols[i]) != solnodenum )
+         if( SCIPsolGetHeur(sols[selection[i]]) != solheur || SCIPsolGetNodenum(sols[selection[i]]) != solnodenum )
             allsame = FALSE;
       }
       *success = !allsame && !SCIPhashtableExists(heurdata->hashtable, elem);
@@ -1058,6 +1071,9 @@ SCIP_RETCODE SCIPincludeHeurCrossover(
 
    assert(heur != NULL);
 
+   /* the heuristic only needs the problem and the solution pool and can therefore run on a copy of the problem */
+   SCIPheurSetAsync(heur, TRUE);
+
    /* set non-NULL pointers to callback methods */
    SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopyCrossover) );
    SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeCrossover) );
@@ -1106,6 +1122,10 @@ SCIP_RETCODE SCIPincludeHeurCrossover(
          "should the choice which sols to take be randomized?",
          &heurdata->randomization, TRUE, DEFAULT_RANDOMIZATION, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/diversify",
+         "should the used solutions differ as much as possible among the best solutions instead of being the best ones?",
+         &heurdata->diversify, TRUE, DEFAULT_DIVERSIFY, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/dontwaitatroot",
          "should the nwaitingnodes parameter be ignored at the root node?",
          &heurdata->dontwaitatroot, TRUE, DEFAULT_DONTWAITATROOT, NULL, NULL) );
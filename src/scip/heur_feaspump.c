@@ -32,9 +32,11 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include "blockmemshell/memory.h"
+#include "lpi/lpi.h"
 #include "scip/cons_linear.h"
 #include "scip/heur_feaspump.h"
 #include "scip/pub_heur.h"
+#include "scip/pub_lp.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
 #include "scip/pub_misc_sort.h"
@@ -92,6 +94,7 @@
 #define DEFAULT_COPYCUTS         TRUE   /**< should all active cuts from the cutpool of the original SCIP be copied to
                                          *   constraints of the subscip
                                          */
+#define DEFAULT_WARMSTART       FALSE   /**< should the pumping LP be warm started from the final basis of the previous call? */
 
 #define MINLPITER                5000   /**< minimal number of LP iterations allowed in each LP solving call */
 
@@ -121,6 +124,11 @@ struct SCIP_HeurData
    int                   neighborhoodsize;   /**< radius of the neighborhood to be searched in stage 3 */
 
    SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator */
+   SCIP_LPISTATE*        lpistate;           /**< final basis of the pumping LP of the previous call, or NULL */
+   int*                  lpistatecols;       /**< indices of the LP columns at the time the basis was stored */
+   int*                  lpistaterows;       /**< indices of the LP rows at the time the basis was stored */
+   int                   nlpistatecols;      /**< number of LP columns at the time the basis was stored */
+   int                   nlpistaterows;      /**< number of LP rows at the time the basis was stored */
    SCIP_Bool             beforecuts;         /**< should the feasibility pump be called at root node before cut separation? */
    SCIP_Bool             usefp20;            /**< should an iterative round-and-propagate scheme be used to find the integral points? */
    SCIP_Bool             pertsolfound;       /**< should a random perturbation be performed if a feasible solution was found? */
@@ -128,6 +136,8 @@ struct SCIP_HeurData
    SCIP_Bool             copycuts;           /**< should all active cuts from cutpool be copied to constraints in
                                               *   subproblem?
                                               */
+   SCIP_Bool             warmstart;          /**< should the pumping LP be warm started from the final basis of the
+                                              *   previous call? */
 };
 
 /* copies SCIP to probing SCIP and creates variable hashmap */
@@ -467,6 +477,119 @@ SCIP_RETCODE handleCycle(
    return SCIP_OKAY;
 }
 
+/** frees the stored basis of the pumping LP */
+static
+SCIP_RETCODE freePumpLPState(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata            /**< heuristic data structure */
+   )
+{
+   assert(heurdata != NULL);
+
+   if( heurdata->lpistate != NULL )
+   {
+      SCIP_LPI* lpi;
+
+      SCIP_CALL( SCIPgetLPI(scip, &lpi) );
+      SCIP_CALL( SCIPlpiFreeState(lpi, SCIPblkmem(scip), &heurdata->lpistate) );
+   }
+   assert(heurdata->lpistate == NULL);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &heurdata->lpistaterows, heurdata->nlpistaterows);
+   SCIPfreeBlockMemoryArrayNull(scip, &heurdata->lpistatecols, heurdata->nlpistatecols);
+   heurdata->nlpistaterows = 0;
+   heurdata->nlpistatecols = 0;
+
+   return SCIP_OKAY;
+}
+
+/** stores the basis of the solved pumping LP together with the columns and rows it refers to */
+static
+SCIP_RETCODE storePumpLPState(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata            /**< heuristic data structure */
+   )
+{
+   SCIP_COL** cols;
+   SCIP_ROW** rows;
+   SCIP_LPI* lpi;
+   int ncols;
+   int nrows;
+   int i;
+
+   assert(heurdata != NULL);
+   assert(SCIPinDive(scip));
+
+   SCIP_CALL( freePumpLPState(scip, heurdata) );
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+
+   if( ncols == 0 || nrows == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetLPI(scip, &lpi) );
+   SCIP_CALL( SCIPlpiGetState(lpi, SCIPblkmem(scip), &heurdata->lpistate) );
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &heurdata->lpistatecols, ncols) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &heurdata->lpistaterows, nrows) );
+   for( i = 0; i < ncols; ++i )
+      heurdata->lpistatecols[i] = SCIPcolGetIndex(cols[i]);
+   for( i = 0; i < nrows; ++i )
+      heurdata->lpistaterows[i] = SCIProwGetIndex(rows[i]);
+   heurdata->nlpistatecols = ncols;
+   heurdata->nlpistaterows = nrows;
+
+   return SCIP_OKAY;
+}
+
+/** installs the stored basis in the pumping LP if the LP still consists of the same columns and rows */
+static
+SCIP_RETCODE restorePumpLPState(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data structure */
+   SCIP_Bool*            success             /**< pointer to store whether the basis was installed */
+   )
+{
+   SCIP_COL** cols;
+   SCIP_ROW** rows;
+   int ncols;
+   int nrows;
+   int i;
+
+   assert(heurdata != NULL);
+   assert(success != NULL);
+   assert(SCIPinDive(scip));
+
+   *success = FALSE;
+
+   if( heurdata->lpistate == NULL )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+
+   /* the basis is only meaningful if the LP did not change structurally, e.g., by adding or removing cuts */
+   if( ncols != heurdata->nlpistatecols || nrows != heurdata->nlpistaterows )
+      return SCIP_OKAY;
+
+   for( i = 0; i < ncols; ++i )
+   {
+      if( SCIPcolGetIndex(cols[i]) != heurdata->lpistatecols[i] )
+         return SCIP_OKAY;
+   }
+   for( i = 0; i < nrows; ++i )
+   {
+      if( SCIProwGetIndex(rows[i]) != heurdata->lpistaterows[i] )
+         return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPsetDiveLPState(scip, heurdata->lpistate) );
+   *success = TRUE;
+
+   return SCIP_OKAY;
+}
+
 /** create the extra constraint of local branching and add it to subscip */
 static
 SCIP_RETCODE addLocalBranchingConstraint(
@@ -680,9 +803,17 @@ SCIP_DECL_HEURINITSOL(heurInitsolFeaspump)
 static
 SCIP_DECL_HEUREXITSOL(heurExitsolFeaspump)
 {
+   SCIP_HEURDATA* heurdata;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
    /* reset the timing mask to its default value */
    SCIPheurSetTimingmask(heur, HEUR_TIMING);
 
+   /* the stored basis refers to columns and rows of this solving process */
+   SCIP_CALL( freePumpLPState(scip, heurdata) );
+
    return SCIP_OKAY;
 }
 
@@ -1156,6 +1287,17 @@ SCIP_DECL_HEUREXEC(heurExecFeaspump)
          SCIP_CALL( SCIPunlinkSol(scip, heurdata->roundedsol) );
       }
 
+      /* warm start the first pumping LP from the final basis of the previous call; the objective changes of this round
+       * are flushed to the LP solver before the basis is installed
+       */
+      if( nloops == 1 && heurdata->warmstart )
+      {
+         SCIP_Bool warmstarted;
+
+         SCIP_CALL( restorePumpLPState(scip, heurdata, &warmstarted) );
+         SCIPdebugMsg(scip, " -> warm start from stored basis: %u\n", warmstarted);
+      }
+
       retcode = SCIPsolveDiveLP(scip, iterlimit, &lperror, NULL);
       lpsolstat = SCIPgetLPSolstat(scip);
 
@@ -1251,6 +1393,12 @@ SCIP_DECL_HEUREXEC(heurExecFeaspump)
          *result = SCIP_FOUNDSOL;
    }
 
+   /* remember the final basis of the pumping LP for the next call */
+   if( heurdata->warmstart && !lperror && lpsolstat == SCIP_LPSOLSTAT_OPTIMAL && nloops > 0 )
+   {
+      SCIP_CALL( storePumpLPState(scip, heurdata) );
+   }
+
    /* end diving */
    SCIP_CALL( SCIPendDive(scip) );
 
@@ -1377,6 +1525,11 @@ SCIP_RETCODE SCIPincludeHeurFeaspump(
 
    /* create Feaspump primal heuristic data */
    SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
+   heurdata->lpistate = NULL;
+   heurdata->lpistatecols = NULL;
+   heurdata->lpistaterows = NULL;
+   heurdata->nlpistatecols = 0;
+   heurdata->nlpistaterows = 0;
 
    /* include primal heuristic */
    SCIP_CALL( SCIPincludeHeurBasic(scip, &heur,
@@ -1462,6 +1615,9 @@ SCIP_RETCODE SCIPincludeHeurFeaspump(
    SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/copycuts",
          "should all active cuts from cutpool be copied to constraints in subproblem?",
          &heurdata->copycuts, TRUE, DEFAULT_COPYCUTS, NULL, NULL) );
+   SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/warmstart",
+         "should the pumping LP be warm started from the final basis of the previous call?",
+         &heurdata->warmstart, TRUE, DEFAULT_WARMSTART, NULL, NULL) );
 
    return SCIP_OKAY;
 }
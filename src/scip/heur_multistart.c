@@ -245,6 +245,98 @@ SCIP_RETCODE getMinFeas(
    return SCIP_OKAY;
 }
 
+/** computes the minimum feasibility of a block of points by evaluating each nlrow at all points at once */
+static
+SCIP_RETCODE getMinFeasBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_NLROW**          nlrows,             /**< array containing all nlrows */
+   int                   nnlrows,            /**< total number of nlrows */
+   SCIP_HASHMAP*         varindex,           /**< maps variables to indicies between 0,..,SCIPgetNVars(scip)-1 */
+   SCIP_SOL**            points,             /**< points */
+   int                   npoints,            /**< number of points */
+   SCIP_Real*            minfeas             /**< buffer to store the minimum feasibility of each point */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_Real* varvals;
+   SCIP_Real* activities;
+   SCIP_Real* exprvals;
+   SCIP_Real inf;
+   int nvars;
+   int i;
+   int j;
+   int p;
+
+   assert(scip != NULL);
+   assert(nlrows != NULL);
+   assert(nnlrows > 0);
+   assert(varindex != NULL);
+   assert(points != NULL);
+   assert(npoints > 0);
+   assert(minfeas != NULL);
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+   inf = SCIPinfinity(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &varvals, (size_t)nvars * npoints) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &activities, npoints) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &exprvals, npoints) );
+
+   /* store the points in structure-of-arrays layout w.r.t. the variable indices */
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_Real* vals = &varvals[(size_t)getVarIndex(varindex, vars[i]) * npoints];
+
+      for( p = 0; p < npoints; ++p )
+         vals[p] = SCIPgetSolVal(scip, points[p], vars[i]);
+   }
+
+   for( p = 0; p < npoints; ++p )
+      minfeas[p] = inf;
+
+   /* compute the activities as in SCIPgetNlRowSolActivity() */
+   for( i = 0; i < nnlrows; ++i )
+   {
+      SCIP_Real lhs = SCIPnlrowGetLhs(nlrows[i]);
+      SCIP_Real rhs = SCIPnlrowGetRhs(nlrows[i]);
+
+      for( p = 0; p < npoints; ++p )
+         activities[p] = SCIPnlrowGetConstant(nlrows[i]);
+
+      for( j = 0; j < SCIPnlrowGetNLinearVars(nlrows[i]); ++j )
+      {
+         SCIP_Real coef = SCIPnlrowGetLinearCoefs(nlrows[i])[j];
+         SCIP_Real* vals = &varvals[(size_t)getVarIndex(varindex, SCIPnlrowGetLinearVars(nlrows[i])[j]) * npoints];
+
+         for( p = 0; p < npoints; ++p )
+            activities[p] += coef * vals[p];
+      }
+
+      if( SCIPnlrowGetExpr(nlrows[i]) != NULL )
+      {
+         SCIP_CALL( SCIPevalExprBatch(scip, SCIPnlrowGetExpr(nlrows[i]), npoints, varindex, varvals, exprvals) );
+
+         for( p = 0; p < npoints; ++p )
+            activities[p] = (exprvals[p] == SCIP_INVALID) ? SCIP_INVALID : activities[p] + exprvals[p]; /*lint !e777*/
+      }
+
+      for( p = 0; p < npoints; ++p )
+      {
+         SCIP_Real activity = MIN(MAX(activities[p], -inf), inf);
+         SCIP_Real feasibility = MIN(rhs - activity, activity - lhs);
+
+         minfeas[p] = MIN(minfeas[p], feasibility);
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &exprvals);
+   SCIPfreeBufferArray(scip, &activities);
+   SCIPfreeBufferArray(scip, &varvals);
+
+   return SCIP_OKAY;
+}
+
 /** computes the gradient for a given point and nonlinear row */
 static
 SCIP_RETCODE computeGradient(
@@ -322,7 +414,7 @@ SCIP_RETCODE improvePoint(
    int                   maxiter,            /**< maximum number of iterations */
    SCIP_Real             minimprfac,         /**< minimum required improving factor to proceed in the improvement of a single point */
    int                   minimpriter,        /**< number of iteration when checking the minimum improvement */
-   SCIP_Real*            minfeas,            /**< pointer to store the minimum feasibility */
+   SCIP_Real*            minfeas,            /**< pointer to the minimum feasibility of the point, which is updated */
    SCIP_Real*            nlrowgradcosts,     /**< estimated costs for each gradient computation */
    SCIP_Real*            gradcosts           /**< pointer to store the estimated gradient costs */
    )
@@ -347,7 +439,6 @@ SCIP_RETCODE improvePoint(
 
    *gradcosts = 0.0;
 
-   SCIP_CALL( getMinFeas(scip, nlrows, nnlrows, point, minfeas) );
 #ifdef SCIP_DEBUG_IMPROVEPOINT
    printf("start minfeas = %e\n", *minfeas);
 #endif
@@ -821,6 +912,8 @@ SCIP_RETCODE applyHeur(
    /*
     * 2. improve points via consensus vectors
     */
+   SCIP_CALL( getMinFeasBatch(scip, nlrows, nnlrows, varindex, points, nrndpoints, feasibilities) );
+
    gradlimit = heurdata->gradlimit == 0.0 ? SCIPinfinity(scip) : heurdata->gradlimit;
    for( npoints = 0; npoints < nrndpoints && gradlimit >= 0 && !SCIPisStopped(scip); ++npoints )
    {
@@ -597,6 +597,9 @@ SCIP_RETCODE SCIPincludeHeurRins(
 
    assert(heur != NULL);
 
+   /* the heuristic only needs the problem and the solution pool and can therefore run on a copy of the problem */
+   SCIPheurSetAsync(heur, TRUE);
+
    /* set non-NULL pointers to callback methods */
    SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopyRins) );
    SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeRins) );
@@ -1111,3 +1111,94 @@ SCIP_RETCODE SCIPaddTrustregionNeighborhoodConstraint(
 
    return SCIP_OKAY;
 }
+
+/** selects solutions that differ as much as possible in the values of the integer variables
+ *
+ *  The first given solution is always selected. Afterwards, the solution whose minimal number of integer variables with
+ *  a different value than in the already selected solutions is largest is selected greedily. Ties are broken in favor of
+ *  solutions that come first in the given array, such that passing the solutions sorted by objective value prefers
+ *  good solutions.
+ */
+SCIP_RETCODE SCIPselectDiverseSols(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SOL**            sols,               /**< solutions to select from */
+   int                   nsols,              /**< number of solutions */
+   int                   nselect,            /**< number of solutions to select, at most nsols */
+   int*                  selection           /**< array to store the indices of the selected solutions */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_Real* lastvals;
+   SCIP_Real* vals;
+   int* mindist;
+   SCIP_Bool* selected;
+   int nbinvars;
+   int nintvars;
+   int i;
+   int j;
+   int k;
+
+   assert(scip != NULL);
+   assert(sols != NULL);
+   assert(selection != NULL);
+   assert(0 <= nselect && nselect <= nsols);
+
+   if( nselect == 0 )
+      return SCIP_OKAY;
+
+   /* the binary and integer variables come first in the variable array */
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, NULL, &nbinvars, &nintvars, NULL, NULL) );
+   nintvars += nbinvars;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &lastvals, nintvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vals, nintvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &mindist, nsols) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &selected, nsols) );
+
+   for( i = 0; i < nsols; ++i )
+      mindist[i] = INT_MAX;
+
+   selection[0] = 0;
+   selected[0] = TRUE;
+
+   for( k = 1; k < nselect; ++k )
+   {
+      int best;
+
+      /* update the minimal distances of the remaining solutions to the selected ones */
+      SCIP_CALL( SCIPgetSolVals(scip, sols[selection[k-1]], nintvars, vars, lastvals) );
+
+      best = -1;
+      for( i = 0; i < nsols; ++i )
+      {
+         int dist;
+
+         if( selected[i] )
+            continue;
+
+         SCIP_CALL( SCIPgetSolVals(scip, sols[i], nintvars, vars, vals) );
+
+         dist = 0;
+         for( j = 0; j < nintvars && dist < mindist[i]; ++j )
+         {
+            if( !SCIPisFeasEQ(scip, vals[j], lastvals[j]) )
+               ++dist;
+         }
+         mindist[i] = MIN(mindist[i], dist);
+
+         if( best == -1 || mindist[i] > mindist[best] )
+            best = i;
+      }
+      assert(best >= 0);
+
+      selection[k] = best;
+      selected[best] = TRUE;
+   }
+
+   SCIPfreeBufferArray(scip, &selected);
+   SCIPfreeBufferArray(scip, &mindist);
+   SCIPfreeBufferArray(scip, &vals);
+   SCIPfreeBufferArray(scip, &lastvals);
+
+   return SCIP_OKAY;
+}
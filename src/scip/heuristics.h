@@ -132,6 +132,22 @@ SCIP_RETCODE SCIPaddTrustregionNeighborhoodConstraint(
    SCIP_Real             violpenalty         /**< the penalty for violating the trust region */
    );
 
+/** selects solutions that differ as much as possible in the values of the integer variables
+ *
+ *  The first given solution is always selected. Afterwards, the solution whose minimal number of integer variables with
+ *  a different value than in the already selected solutions is largest is selected greedily. Ties are broken in favor of
+ *  solutions that come first in the given array, such that passing the solutions sorted by objective value prefers
+ *  good solutions.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPselectDiverseSols(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SOL**            sols,               /**< solutions to select from */
+   int                   nsols,              /**< number of solutions */
+   int                   nselect,            /**< number of solutions to select, at most nsols */
+   int*                  selection           /**< array to store the indices of the selected solutions */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
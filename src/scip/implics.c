@@ -951,6 +951,11 @@ SCIP_Bool SCIPimplicsContainsImpl(
  * methods for cliques
  */
 
+#define CLIQUELIST_MINSHRINKSIZE   16        /**< minimal size of a clique list array before it gets compacted */
+#define CLIQUELIST_SEARCHRATIO      8        /**< minimal length ratio of two clique lists for binary searching the
+                                              *   longer one in a common clique query */
+#define CLIQUE_MINSHRINKSIZE       16        /**< minimal size of the arrays of a clique before they get compacted */
+
 /* swaps cliques at positions first and second in cliques array of clique table */
 static
 void cliquetableSwapCliques(
@@ -1075,6 +1080,27 @@ SCIP_RETCODE cliqueEnsureSize(
    return SCIP_OKAY;
 }
 
+/** shrinks the arrays of a clique to its number of variables if most of their memory is unused, e.g., after fixed
+ *  variables were removed from the clique
+ */
+static
+SCIP_RETCODE cliqueCompact(
+   SCIP_CLIQUE*          clique,             /**< clique data structure */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   assert(clique != NULL);
+
+   if( clique->size >= CLIQUE_MINSHRINKSIZE && 2 * clique->nvars <= clique->size && clique->nvars > 0 )
+   {
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &clique->vars, clique->size, clique->nvars) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &clique->values, clique->size, clique->nvars) );
+      clique->size = clique->nvars;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** returns the position of the given variable/value pair in the clique; returns -1 if variable/value pair is not member
  *  of the clique
  */
@@ -1417,6 +1443,35 @@ void cliqueCheck(
 #define cliqueCheck(clique) /**/
 #endif
 
+/** returns the bit of the clique in the id masks of the clique lists */
+static
+uint64_t cliqueGetIdBit(
+   SCIP_CLIQUE*          clique              /**< clique data structure */
+   )
+{
+   assert(clique != NULL);
+
+   return (uint64_t)1 << (clique->id % 64); /*lint !e703*/
+}
+
+/** returns the id mask of the given cliques */
+static
+uint64_t cliquesGetIdMask(
+   SCIP_CLIQUE**         cliques,            /**< array of cliques */
+   int                   ncliques            /**< number of cliques in the cliques array */
+   )
+{
+   uint64_t idmask = 0;
+   int i;
+
+   assert(cliques != NULL || ncliques == 0);
+
+   for( i = 0; i < ncliques; ++i )
+      idmask |= cliqueGetIdBit(cliques[i]);  /*lint !e613*/
+
+   return idmask;
+}
+
 /** creates a clique list data structure */
 static
 SCIP_RETCODE cliquelistCreate(
@@ -1433,6 +1488,8 @@ SCIP_RETCODE cliquelistCreate(
    (*cliquelist)->ncliques[1] = 0;
    (*cliquelist)->size[0] = 0;
    (*cliquelist)->size[1] = 0;
+   (*cliquelist)->idmask[0] = 0;
+   (*cliquelist)->idmask[1] = 0;
 
    return SCIP_OKAY;
 }
@@ -1504,9 +1561,28 @@ SCIP_RETCODE SCIPcliquelistAdd(
    {
       if( (*cliquelist)->cliques[value] != NULL )
       {
-         for( i = (*cliquelist)->ncliques[value]; i > 0 && (*cliquelist)->cliques[value][i - 1]->id > id; --i ); /*lint !e574 !e722*/
+         SCIP_CLIQUE** cliques = (*cliquelist)->cliques[value];
+         int right;
+
+         /* cliques are mostly created with increasing ids, so check the last position before searching the list */
+         i = (*cliquelist)->ncliques[value];
+         if( i > 0 && cliques[i - 1]->id > id )
+         {
+            /* find the first position with a larger id by binary search */
+            right = i - 1;
+            i = 0;
+            while( i < right )
+            {
+               int middle = (i + right) / 2;
+
+               if( cliques[middle]->id > id )
+                  right = middle;
+               else
+                  i = middle + 1;
+            }
+         }
          /* do not put the same clique twice in the cliquelist */
-         if( i > 0 && (*cliquelist)->cliques[value][i - 1]->id == id )
+         if( i > 0 && cliques[i - 1]->id == id )
             return SCIP_OKAY;
       }
    }
@@ -1519,6 +1595,7 @@ SCIP_RETCODE SCIPcliquelistAdd(
 
    (*cliquelist)->cliques[value][i] = clique;
    (*cliquelist)->ncliques[value]++;
+   (*cliquelist)->idmask[value] |= cliqueGetIdBit(clique);
 
    return SCIP_OKAY;
 }
@@ -1594,7 +1671,31 @@ SCIP_RETCODE SCIPcliquelistDel(
 
    /* free cliquelist if it is empty */
    if( (*cliquelist)->ncliques[0] == 0 && (*cliquelist)->ncliques[1] == 0 )
+   {
       SCIPcliquelistFree(cliquelist, blkmem);
+      return SCIP_OKAY;
+   }
+
+   /* the bit of the removed clique may be shared with other cliques in the list, so the mask is recomputed */
+   (*cliquelist)->idmask[value] = cliquesGetIdMask((*cliquelist)->cliques[value], (*cliquelist)->ncliques[value]);
+
+   /* compact the list if most of its memory is unused, e.g., after the clique table cleanup removed many cliques */
+   if( (*cliquelist)->size[value] >= CLIQUELIST_MINSHRINKSIZE
+      && 4 * (*cliquelist)->ncliques[value] <= (*cliquelist)->size[value] )
+   {
+      int newsize = 2 * (*cliquelist)->ncliques[value];
+
+      if( newsize == 0 )
+      {
+         BMSfreeBlockMemoryArray(blkmem, &(*cliquelist)->cliques[value], (*cliquelist)->size[value]);
+      }
+      else
+      {
+         SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*cliquelist)->cliques[value], (*cliquelist)->size[value],
+               newsize) ); /*lint !e866*/
+      }
+      (*cliquelist)->size[value] = newsize;
+   }
 
    return SCIP_OKAY;
 }
@@ -1619,6 +1720,10 @@ SCIP_Bool SCIPcliquelistsHaveCommonClique(
    if( cliquelist1 == NULL || cliquelist2 == NULL )
       return FALSE;
 
+   /* a common clique sets the same bit in both masks */
+   if( (cliquelist1->idmask[value1] & cliquelist2->idmask[value2]) == 0 )
+      return FALSE;
+
    ncliques1 = cliquelist1->ncliques[value1];
    cliques1 = cliquelist1->cliques[value1];
    ncliques2 = cliquelist2->ncliques[value2];
@@ -1645,6 +1750,37 @@ SCIP_Bool SCIPcliquelistsHaveCommonClique(
          ncliques2 = tmpi;
       }
 
+      /* if the first list is much longer, search the cliques of the second list in it instead of scanning it */
+      if( ncliques1 >= CLIQUELIST_SEARCHRATIO * ncliques2 )
+      {
+         for( ; i2 < ncliques2; ++i2 )
+         {
+            int right;
+
+            cliqueid = SCIPcliqueGetId(cliques2[i2]);
+
+            /* the remaining cliques of the first list are sorted by increasing ids as well */
+            if( SCIPcliqueGetId(cliques1[ncliques1 - 1]) < cliqueid )
+               break;
+
+            right = ncliques1 - 1;
+            while( i1 < right )
+            {
+               int middle = (i1 + right) / 2;
+
+               if( SCIPcliqueGetId(cliques1[middle]) < cliqueid )
+                  i1 = middle + 1;
+               else
+                  right = middle;
+            }
+
+            if( SCIPcliqueGetId(cliques1[i1]) == cliqueid )
+               return TRUE;
+         }
+
+         return FALSE;
+      }
+
       /* check whether both clique lists have a same clique */
       while( TRUE )  /*lint !e716*/
       {
@@ -1811,6 +1947,8 @@ SCIP_RETCODE SCIPcliquetableCreate(
    (*cliquetable)->ncleanupaggrvars = 0;
    (*cliquetable)->ndirtycliques = 0;
    (*cliquetable)->nentries = 0;
+   (*cliquetable)->ncompdelentries = 0;
+   (*cliquetable)->ncompnonbinvars = 0;
    (*cliquetable)->incleanup = FALSE;
    (*cliquetable)->compsfromscratch = FALSE;
    (*cliquetable)->ncliquecomponents = -1;
@@ -2342,6 +2480,13 @@ void cliquetableUpdateConnectednessClique(
 
       lastnode = currnode;
    }
+
+   /* keep the number of components up to date */
+   if( !cliquetable->compsfromscratch )
+   {
+      cliquetable->ncliquecomponents = SCIPdisjointsetGetComponentCount(cliquetable->djset) - cliquetable->ncompnonbinvars;
+      assert(cliquetable->ncliquecomponents >= 0);
+   }
 }
 
 /** returns the index of the connected component of the clique graph that the variable belongs to, or -1  */
@@ -2883,6 +3028,8 @@ SCIP_RETCODE cliqueCleanup(
 
       /* @todo check if we can aggregate variables if( clique->equation && clique->nvars == 2 ) */
 
+      SCIP_CALL( cliqueCompact(clique, blkmem) );
+
       clique->startcleanup = -1;
    }
    assert(SCIPcliqueIsCleanedUp(clique));
@@ -2963,6 +3110,7 @@ SCIP_RETCODE SCIPcliquetableCleanup(
       /* remove not clean up clique from hastable */
       SCIP_CALL( SCIPhashtableRemove(cliquetable->hashtable, (void*)clique) );
       cliquetable->nentries -= clique->nvars;
+      cliquetable->ncompdelentries += clique->nvars;
       assert(cliquetable->nentries >= 0);
 
       SCIP_CALL( cliqueCleanup(clique, blkmem, set, stat, transprob, origprob, tree, reopt, lp, branchcand, eventqueue,
@@ -3089,6 +3237,10 @@ SCIP_RETCODE SCIPcliquetableCleanup(
       else
       {
          cliquetable->nentries += clique->nvars;
+         cliquetable->ncompdelentries -= clique->nvars;
+
+         /* connect the active representatives that replaced aggregated variables of the clique */
+         cliquetableUpdateConnectednessClique(cliquetable, clique);
 
          SCIP_CALL( SCIPhashtableInsert(cliquetable->hashtable, (void*)clique) );
          if( !clique->eventsissued )
@@ -3126,7 +3278,8 @@ SCIP_RETCODE SCIPcliquetableCleanup(
 
 /** computes connected components of the clique table
  *
- *  an update becomes necessary if a clique gets added with variables from different components
+ *  added cliques update the components incrementally; a computation from scratch becomes necessary if a clique gets
+ *  added with a variable that is not yet a node of the graph, or if many clique entries were removed
  */
 SCIP_RETCODE SCIPcliquetableComputeCliqueComponents(
    SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
@@ -3153,6 +3306,7 @@ SCIP_RETCODE SCIPcliquetableComputeCliqueComponents(
 
    nimplbinvars = 0;
    cliquetable->compsfromscratch = FALSE;
+   cliquetable->ncompdelentries = 0;
    ndiscvars = nbinvars + nintvars + nimplvars;
 
    /* detect integer and implicit integer variables with bounds {0,1} because they might appear in cliques, as well */
@@ -3227,6 +3381,7 @@ SCIP_RETCODE SCIPcliquetableComputeCliqueComponents(
 
    /* subtract all (implicit) integer for which SCIPvarIsBinary() returns FALSE */
    nnonbinvars = (nintvars + nimplvars) - nimplbinvars;
+   cliquetable->ncompnonbinvars = nnonbinvars;
 
    cliques = cliquetable->cliques;
 
@@ -3550,10 +3705,13 @@ int SCIPcliquetableGetNCliqueComponents(
    return cliquetable->compsfromscratch ? -1 : cliquetable->ncliquecomponents;
 }
 
-/** returns TRUE iff the connected clique components need an update (because new cliques were added) */
+/** returns TRUE iff the connected clique components need an update (because new variables appeared or more than half
+ *  of the clique entries were removed since the last computation)
+ */
 SCIP_Bool SCIPcliquetableNeedsComponentUpdate(
    SCIP_CLIQUETABLE*     cliquetable         /**< clique table data structure */
    )
 {
-   return cliquetable->compsfromscratch || cliquetable->djset == NULL;
+   return cliquetable->compsfromscratch || cliquetable->djset == NULL
+      || cliquetable->ncompdelentries > cliquetable->nentries;
 }
@@ -372,7 +372,8 @@ SCIP_RETCODE SCIPcliquetableCleanup(
  *  use depth-first search similarly to the components presolver/constraint handler, representing a clique as a
  *  path to reduce memory usage, but leaving the connected components the same
  *
- *  an update becomes necessary if a clique gets added with variables from different components
+ *  added cliques update the components incrementally; a computation from scratch becomes necessary if a clique gets
+ *  added with a variable that is not yet a node of the graph, or if many clique entries were removed
  */
 SCIP_RETCODE SCIPcliquetableComputeCliqueComponents(
    SCIP_CLIQUETABLE*     cliquetable,        /**< clique table data structure */
@@ -433,7 +434,9 @@ int SCIPcliquetableGetNCliqueComponents(
    SCIP_CLIQUETABLE*     cliquetable         /**< clique table data structure */
    );
 
-/** returns TRUE iff the connected clique components need an update (because new cliques were added) */
+/** returns TRUE iff the connected clique components need an update (because new variables appeared or more than half
+ *  of the clique entries were removed since the last computation)
+ */
 SCIP_Bool SCIPcliquetableNeedsComponentUpdate(
    SCIP_CLIQUETABLE*     cliquetable         /**< clique table data structure */
    );
@@ -451,7 +454,8 @@ SCIP_Bool SCIPcliquetableNeedsComponentUpdate(
 #define SCIPcliquetableGetCliques(cliquetable)       ((cliquetable)->cliques)
 #define SCIPcliquetableGetNEntries(cliquetable)      ((cliquetable)->nentries)
 #define SCIPcliquetableGetNCliqueComponents(cliquetable) (cliquetable->compsfromscratch ? -1 : cliquetable->ncliquecomponents)
-#define SCIPcliquetableNeedsComponentUpdate(cliquetable) (cliquetable->compsfromscratch || cliquetable->djset == NULL)
+#define SCIPcliquetableNeedsComponentUpdate(cliquetable) (cliquetable->compsfromscratch || cliquetable->djset == NULL \
+      || cliquetable->ncompdelentries > cliquetable->nentries)
 #endif
 
 #ifdef __cplusplus
@@ -632,6 +632,20 @@ void SCIPintervalUnify(
    resultant->sup = MAX(operand1.sup, operand2.sup);
 }
 
+/** returns the negation of an interval, which is exact in any rounding mode */
+static
+SCIP_INTERVAL intervalNegate(
+   SCIP_INTERVAL         operand             /**< operand to negate */
+   )
+{
+   SCIP_INTERVAL resultant;
+
+   resultant.inf = -operand.sup;
+   resultant.sup = -operand.inf;
+
+   return resultant;
+}
+
 /** adds operand1 and operand2 and stores infimum of result in infimum of resultant */
 void SCIPintervalAddInf(
    SCIP_Real             infinity,           /**< value for infinity */
@@ -763,7 +777,11 @@ void SCIPintervalAddScalar(
    intervalSetRoundingMode(roundmode);
 }
 
-/** adds vector operand1 and vector operand2 and stores result in vector resultant */
+/** adds vector operand1 and vector operand2 and stores result in vector resultant
+ *
+ * All bounds are computed with rounding upwards, where the infimums are obtained as negated supremums of the sums of
+ * the negated operands, so the rounding mode is changed at most twice.
+ */
 void SCIPintervalAddVectors(
    SCIP_Real             infinity,           /**< value for infinity */
    SCIP_INTERVAL*        resultant,          /**< array of resultant intervals of operation */
@@ -773,24 +791,28 @@ void SCIPintervalAddVectors(
    )
 {
    SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL op1;
+   SCIP_INTERVAL op2;
+   SCIP_INTERVAL negsum;
    int i;
 
    roundmode = intervalGetRoundingMode();
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
 
-   /* compute infimums of resultant array */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
    for( i = 0; i < length; ++i )
    {
-      SCIPintervalAddInf(infinity, &resultant[i], operand1[i], operand2[i]);
-   }
-   /* compute supremums of result array */
-   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
-   for( i = 0; i < length; ++i )
-   {
-      SCIPintervalAddSup(infinity, &resultant[i], operand1[i], operand2[i]);
+      op1 = operand1[i];
+      op2 = operand2[i];
+
+      /* infimum of sum is negated supremum of sum of negated operands */
+      SCIPintervalAddSup(infinity, &negsum, intervalNegate(op1), intervalNegate(op2));
+      SCIPintervalAddSup(infinity, &resultant[i], op1, op2);
+      resultant[i].inf = -negsum.sup;
    }
 
-   intervalSetRoundingMode(roundmode);
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(roundmode);
 }
 
 /** subtracts operand2 from operand1 and stores result in resultant */
@@ -1204,6 +1226,44 @@ void SCIPintervalDiv(
    intervalSetRoundingMode(roundmode);
 }
 
+/** divides operand1 by nonzero scalar operand2 and stores infimum of result in infimum of resultant */
+static
+void intervalDivScalarInf(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< resultant interval of operation */
+   SCIP_INTERVAL         operand1,           /**< first operand of operation */
+   SCIP_Real             operand2            /**< second operand of operation; can be +/- inf */
+   )
+{
+   assert(intervalGetRoundingMode() == SCIP_ROUND_DOWNWARDS);
+   assert(resultant != NULL);
+   assert(operand2 != 0.0);
+
+   if( operand2 >= infinity || operand2 <= -infinity )
+   {
+      /* division by +/-infinity is 0.0 */
+      resultant->inf = 0.0;
+   }
+   else if( operand2 > 0.0 )
+   {
+      if( operand1.inf <= -infinity )
+         resultant->inf = -infinity;
+      else if( operand1.inf >= infinity )
+         resultant->inf = infinity;
+      else
+         resultant->inf = operand1.inf / operand2;
+   }
+   else
+   {
+      if( operand1.sup >= infinity )
+         resultant->inf = -infinity;
+      else if( operand1.sup <= -infinity )
+         resultant->inf = infinity;
+      else
+         resultant->inf = operand1.sup / operand2;
+   }
+}
+
 /** divides operand1 by scalar operand2 and stores result in resultant */
 void SCIPintervalDivScalar(
    SCIP_Real             infinity,           /**< value for infinity */
@@ -1427,6 +1487,63 @@ void SCIPintervalScalprodScalars(
    intervalSetRoundingMode(roundmode);
 }
 
+/** computes the weighted sum of a vector of intervals plus a constant and stores result in resultant
+ *
+ * Both bounds are computed with rounding upwards, where the infimum is obtained as negated supremum of the weighted
+ * sum with negated weights and constant. Thus, the rounding mode is changed at most twice, and not at all if it has
+ * been set to upwards before, so that many sums can be evaluated after a single call of
+ * SCIPintervalSetRoundingModeUpwards().
+ * The result is the same as when adding the products of operands and weights one by one via SCIPintervalMulScalar()
+ * and SCIPintervalAdd(). If any operand is empty, then the result is empty.
+ */
+void SCIPintervalWeightedSum(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< resultant interval of operation */
+   int                   length,             /**< number of operands */
+   SCIP_INTERVAL*        operands,           /**< array of operands */
+   SCIP_Real*            weights,            /**< weights of operands; can have +/-inf entries */
+   SCIP_Real             constant            /**< constant to add */
+   )
+{
+   SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL negsum;
+   SCIP_INTERVAL term;
+   int i;
+
+   assert(resultant != NULL);
+   assert(operands != NULL || length == 0);
+   assert(weights != NULL || length == 0);
+
+   roundmode = intervalGetRoundingMode();
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
+
+   /* negsum.sup is the negated infimum of the sum */
+   resultant->sup = constant;
+   negsum.sup = -constant;
+
+   for( i = 0; i < length; ++i )
+   {
+      if( SCIPintervalIsEmpty(infinity, operands[i]) )  /*lint !e613*/
+      {
+         SCIPintervalSetEmpty(resultant);
+         goto TERMINATE;
+      }
+
+      SCIPintervalMulScalarSup(infinity, &term, operands[i], weights[i]);  /*lint !e613*/
+      SCIPintervalAddSup(infinity, resultant, *resultant, term);
+
+      SCIPintervalMulScalarSup(infinity, &term, operands[i], -weights[i]);  /*lint !e613*/
+      SCIPintervalAddSup(infinity, &negsum, negsum, term);
+   }
+
+   resultant->inf = -negsum.sup;
+
+TERMINATE:
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(roundmode);
+}
+
 /** squares operand and stores result in resultant */
 void SCIPintervalSquare(
    SCIP_Real             infinity,           /**< value for infinity */
@@ -4635,6 +4752,7 @@ int SCIPintervalPropagateWeightedSum(
 {
    SCIP_ROUNDMODE prevroundmode;
    SCIP_INTERVAL childbounds;
+   SCIP_INTERVAL negbounds;
    SCIP_Real minlinactivity;
    SCIP_Real maxlinactivity;
    int minlinactivityinf;
@@ -4679,7 +4797,12 @@ int SCIPintervalPropagateWeightedSum(
          goto TERMINATE;
       }
 
-      SCIPintervalMulScalar(infinity, &resultants[c], childbounds, weights[c]);
+      /* multiply by the child coefficient in downward rounding mode; the supremum is the negated infimum of the
+       * product with the negated coefficient
+       */
+      SCIPintervalMulScalarInf(infinity, &negbounds, childbounds, -weights[c]);
+      SCIPintervalMulScalarInf(infinity, &resultants[c], childbounds, weights[c]);
+      resultants[c].sup = -negbounds.inf;
 
       if( resultants[c].sup >= infinity )
          ++maxlinactivityinf;
@@ -4764,8 +4887,17 @@ int SCIPintervalPropagateWeightedSum(
       }
 #endif
 
-      /* divide by the child coefficient */
-      SCIPintervalDivScalar(infinity, &childbounds, childbounds, weights[c]);
+      /* divide by the child coefficient, again computing the supremum as negated infimum if possible */
+      if( weights[c] != 0.0 )
+      {
+         intervalDivScalarInf(infinity, &negbounds, childbounds, -weights[c]);
+         intervalDivScalarInf(infinity, &childbounds, childbounds, weights[c]);
+         childbounds.sup = -negbounds.inf;
+      }
+      else
+      {
+         SCIPintervalDivScalar(infinity, &childbounds, childbounds, weights[c]);
+      }
 
       SCIPdebugPrintf(" -> x = [%.20g,%.20g]\n", childbounds.inf, childbounds.sup);
 
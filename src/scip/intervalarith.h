@@ -441,6 +441,21 @@ void SCIPintervalScalprodScalars(
    SCIP_Real*            operand2            /**< second vector as array of scalars; can have +/-inf entries */
    );
 
+/** computes the weighted sum of a vector of intervals plus a constant and stores result in resultant
+ *
+ * Both bounds are computed with rounding upwards, so the rounding mode is not changed if it has been set to upwards
+ * before, e.g., by SCIPintervalSetRoundingModeUpwards(). If any operand is empty, then the result is empty.
+ */
+SCIP_EXPORT
+void SCIPintervalWeightedSum(
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_INTERVAL*        resultant,          /**< resultant interval of operation */
+   int                   length,             /**< number of operands */
+   SCIP_INTERVAL*        operands,           /**< array of operands */
+   SCIP_Real*            weights,            /**< weights of operands; can have +/-inf entries */
+   SCIP_Real             constant            /**< constant to add */
+   );
+
 /** squares operand and stores result in resultant */
 SCIP_EXPORT
 void SCIPintervalSquare(
@@ -9868,6 +9868,42 @@ SCIP_RETCODE SCIPlpGetBInvRow(
    return SCIP_OKAY;
 }
 
+/** gets several rows from the inverse basis matrix B^-1; the k-th row is stored at coefs[k * nrows] */
+SCIP_RETCODE SCIPlpGetBInvRows(
+   SCIP_LP*              lp,                 /**< LP data */
+   int                   nrs,                /**< number of rows to get */
+   const int*            rs,                 /**< row numbers */
+   SCIP_Real*            coefs,              /**< array of size nrs * nrows to store the coefficients of the rows */
+   int*                  inds,               /**< array of size nrs * nrows to store the non-zero indices, or NULL */
+   int*                  ninds               /**< array of size nrs to store the numbers of non-zero indices, or NULL
+                                              *  (-1: if we do not store sparsity informations) */
+   )
+{
+#ifndef NDEBUG
+   int k;
+#endif
+
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(lp->solved);
+   assert(lp->solisbasic);
+   assert(nrs >= 0);
+   assert(rs != NULL || nrs == 0);
+   assert(coefs != NULL);
+
+#ifndef NDEBUG
+   for( k = 0; k < nrs; ++k )
+      assert(0 <= rs[k] && rs[k] < lp->nrows);  /* the basis matrix is nrows x nrows */
+#endif
+
+   if( nrs == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPlpiGetBInvRows(lp->lpi, nrs, rs, coefs, inds, ninds) );
+
+   return SCIP_OKAY;
+}
+
 /** gets a column from the inverse basis matrix B^-1 */
 SCIP_RETCODE SCIPlpGetBInvCol(
    SCIP_LP*              lp,                 /**< LP data */
@@ -870,6 +870,17 @@ SCIP_RETCODE SCIPlpGetBInvRow(
                                               *  (-1: if we do not store sparsity informations) */
    );
 
+/** gets several rows from the inverse basis matrix B^-1; the k-th row is stored at coefs[k * nrows] */
+SCIP_RETCODE SCIPlpGetBInvRows(
+   SCIP_LP*              lp,                 /**< LP data */
+   int                   nrs,                /**< number of rows to get */
+   const int*            rs,                 /**< row numbers */
+   SCIP_Real*            coefs,              /**< array of size nrs * nrows to store the coefficients of the rows */
+   int*                  inds,               /**< array of size nrs * nrows to store the non-zero indices, or NULL */
+   int*                  ninds               /**< array of size nrs to store the numbers of non-zero indices, or NULL
+                                              *  (-1: if we do not store sparsity informations) */
+   );
+
 /** gets a column from the inverse basis matrix B^-1 */
 SCIP_RETCODE SCIPlpGetBInvCol(
    SCIP_LP*              lp,                 /**< LP data */
@@ -46,6 +46,7 @@
 #include "scip/reopt.h"
 #include "scip/disp.h"
 #include "scip/struct_event.h"
+#include "scip/struct_sol.h"
 #include "scip/pub_message.h"
 #include "scip/pub_var.h"
 #include "scip/scip_solvingstats.h"
@@ -625,6 +626,77 @@ SCIP_RETCODE SCIPprimalUpdateRay(
    return SCIP_OKAY;
 }
 
+/** returns the hash value of the integral assignment of a solution in the solution storage */
+static
+uint32_t primalGetStoredSolHash(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_PROB*            origprob,           /**< original problem */
+   SCIP_SOL*             sol                 /**< solution in the solution storage */
+   )
+{
+   assert(sol != NULL);
+
+   /* solutions in the storage do not change anymore, so the hash value is only computed once */
+   if( !sol->hasassignhash )
+   {
+      sol->assignhash = SCIPsolGetIntAssignmentHash(sol, set, stat, origprob);
+      sol->hasassignhash = TRUE;
+   }
+
+   return sol->assignhash;
+}
+
+/** returns the position of the solution that should be removed from the full solution storage to make room for a new
+ *  solution
+ *
+ *  Usually, this is the worst solution. If diverse solutions should be kept, the worst solution that is not better than
+ *  the new solution and whose integral assignment coincides with the one of a better solution is removed instead, if
+ *  such a solution exists.
+ */
+static
+int primalGetRemovePos(
+   SCIP_PRIMAL*          primal,             /**< primal data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_PROB*            origprob,           /**< original problem */
+   SCIP_SOL*             sol,                /**< new solution */
+   int                   insertpos           /**< position at which the new solution is inserted */
+   )
+{
+   uint32_t solhash;
+   int pos;
+   int i;
+
+   assert(primal != NULL);
+   assert(primal->nsols > 0);
+   assert(0 <= insertpos && insertpos < primal->nsols);
+
+   if( !set->misc_diversesols )
+      return primal->nsols - 1;
+
+   solhash = primalGetStoredSolHash(set, stat, origprob, sol);
+
+   for( pos = primal->nsols - 1; pos >= insertpos; --pos )
+   {
+      uint32_t poshash;
+
+      poshash = primalGetStoredSolHash(set, stat, origprob, primal->sols[pos]);
+
+      /* the new solution is better than all solutions from insertpos on */
+      if( poshash == solhash )
+         return pos;
+
+      for( i = 0; i < pos; ++i )
+      {
+         if( primalGetStoredSolHash(set, stat, origprob, primal->sols[i]) == poshash )
+            return pos;
+      }
+   }
+
+   return primal->nsols - 1;
+}
+
 /** adds primal solution to solution storage at given position */
 static
 SCIP_RETCODE primalAddSol(
@@ -676,6 +748,9 @@ SCIP_RETCODE primalAddSol(
 
    obj = SCIPsolGetObj(sol, set, transprob, origprob);
 
+   /* the solution may have been changed since the hash value of its integral assignment was stored */
+   sol->hasassignhash = FALSE;
+
    SCIPsetDebugMsg(set, "insert primal solution %p with obj %g at position %d (replace=%u):\n",
       (void*)sol, obj, insertpos, replace);
 
@@ -744,12 +819,22 @@ SCIP_RETCODE primalAddSol(
    {
       SCIP_CALL( SCIPsolTransform(primal->sols[insertpos], solptr, blkmem, set, primal) );
       sol = primal->sols[insertpos];
+      sol->hasassignhash = FALSE;
    }
    else
    {
       if( primal->nsols == set->limit_maxsol )
       {
-         SCIP_CALL( SCIPsolFree(&primal->sols[set->limit_maxsol - 1], blkmem, primal) );
+         int removepos;
+
+         removepos = primalGetRemovePos(primal, set, stat, origprob, sol, insertpos);
+         assert(insertpos <= removepos && removepos < primal->nsols);
+
+         SCIP_CALL( SCIPsolFree(&primal->sols[removepos], blkmem, primal) );
+
+         /* close the gap; the last slot is overwritten when the worse solutions are moved below */
+         for( pos = removepos; pos < primal->nsols - 1; ++pos )
+            primal->sols[pos] = primal->sols[pos+1];
       }
       else
       {
@@ -888,6 +973,7 @@ SCIP_RETCODE primalAddOrigSol(
    assert(0 <= insertpos && insertpos < primal->nsols);
    primal->sols[insertpos] = sol;
    primal->nsolsfound++;
+   sol->hasassignhash = FALSE;
 
    /* check if solution is better than objective limit */
    if( SCIPsetIsFeasLE(set, SCIPsolGetOrigObj(sol), SCIPprobGetObjlim(prob, set)) )
@@ -1015,6 +1101,32 @@ int primalSearchOrigSolPos(
    return right;
 }
 
+/** returns whether a solution can be equal to a solution in the solution storage by comparing the hash values of their
+ *  integral assignments, which is much cheaper than comparing the solutions if there are many near-duplicates
+ */
+static
+SCIP_Bool primalSolsMayBeEqual(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_PROB*            origprob,           /**< original problem */
+   SCIP_SOL*             sol,                /**< solution to check */
+   SCIP_SOL*             storedsol,          /**< solution in the solution storage */
+   uint32_t*             solhash,            /**< pointer to the hash value of sol */
+   SCIP_Bool*            hassolhash          /**< pointer to store whether the hash value of sol has been computed */
+   )
+{
+   assert(solhash != NULL);
+   assert(hassolhash != NULL);
+
+   if( !(*hassolhash) )
+   {
+      *solhash = SCIPsolGetIntAssignmentHash(sol, set, stat, origprob);
+      *hassolhash = TRUE;
+   }
+
+   return *solhash == primalGetStoredSolHash(set, stat, origprob, storedsol);
+}
+
 /** returns whether the given primal solution is already existent in the solution storage */
 static
 SCIP_Bool primalExistsSol(
@@ -1030,6 +1142,8 @@ SCIP_Bool primalExistsSol(
    )
 {
    SCIP_Real obj;
+   uint32_t solhash;
+   SCIP_Bool hassolhash;
    int i;
 
    assert(primal != NULL);
@@ -1037,6 +1151,10 @@ SCIP_Bool primalExistsSol(
    assert(replace != NULL);
    assert(0 <= (*insertpos) && (*insertpos) <= primal->nsols);
 
+   /* the hash value of the integral assignment is only computed if there is a solution with the same objective value */
+   solhash = 0;
+   hassolhash = FALSE;
+
    obj = SCIPsolGetObj(sol, set, transprob, origprob);
 
    assert(primal->sols != NULL || primal->nsols == 0);
@@ -1057,7 +1175,8 @@ SCIP_Bool primalExistsSol(
       if( SCIPsetIsLT(set, solobj, obj) )
          break;
 
-      if( SCIPsolsAreEqual(sol, primal->sols[i], set, stat, origprob, transprob) )
+      if( primalSolsMayBeEqual(set, stat, origprob, sol, primal->sols[i], &solhash, &hassolhash)
+         && SCIPsolsAreEqual(sol, primal->sols[i], set, stat, origprob, transprob) )
       {
          if( set->stage >= SCIP_STAGE_PRESOLVED && SCIPsolIsOriginal(primal->sols[i]) && !SCIPsolIsOriginal(sol) )
          {
@@ -1083,7 +1202,8 @@ SCIP_Bool primalExistsSol(
       if( SCIPsetIsGT(set, solobj, obj) )
          break;
 
-      if( SCIPsolsAreEqual(sol, primal->sols[i], set, stat, origprob, transprob) )
+      if( primalSolsMayBeEqual(set, stat, origprob, sol, primal->sols[i], &solhash, &hassolhash)
+         && SCIPsolsAreEqual(sol, primal->sols[i], set, stat, origprob, transprob) )
       {
          if( set->stage >= SCIP_STAGE_PRESOLVED && SCIPsolIsOriginal(primal->sols[i]) && !SCIPsolIsOriginal(sol) )
          {
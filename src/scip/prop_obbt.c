@@ -47,6 +47,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "lpi/lpi.h"
 #include "scip/cons_indicator.h"
 #include "scip/cons_linear.h"
 #include "scip/cons_nonlinear.h"
@@ -79,6 +80,7 @@
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 
 #define PROP_NAME                       "obbt"
 #define PROP_DESC                       "optimization-based bound tightening propagator"
@@ -130,6 +132,7 @@
 #define DEFAULT_ITLIMITFAC_BILININEQS    3.0 /**< multiple of OBBT LP limit used as total LP iteration limit for solving bilinear inequality LPs (< 0 for no limit) */
 #define DEFAULT_MINNONCONVEXITY         1e-1 /**< minimum nonconvexity for choosing a bilinear term */
 #define DEFAULT_RANDSEED                 149 /**< initial random seed */
+#define DEFAULT_NTHREADS                   1 /**< number of threads used to solve the OBBT LPs (1: sequential) */
 
 /*
  * Data structures
@@ -235,6 +238,7 @@ struct SCIP_PropData
    int                   propagatefreq;      /**< trigger a propagation round after that many bound tightenings
                                               *   (0: no propagation) */
    int                   propagatecounter;   /**< number of bound tightenings since the last propagation round */
+   int                   nthreads;           /**< number of threads used to solve the OBBT LPs (1: sequential) */
 };
 
 
@@ -2041,6 +2045,638 @@ SCIP_RETCODE findNewBounds(
    return SCIP_OKAY;
 }
 
+/** data of a job that solves the OBBT LPs of a subset of the bounds on its own copy of the probing LP */
+struct ObbtJob
+{
+   SCIP_LPI*             lpi;                /**< copy of the probing LP */
+   BOUND**               bounds;             /**< bounds of the job in the order in which they are processed */
+   int*                  colpos;             /**< LP positions of the columns of the bounds' variables */
+   SCIP_Bool*            integral;           /**< are the bounds' variables integral? */
+   SCIP_Real*            newvals;            /**< optimal values of the bound LPs */
+   SCIP_Bool*            solved;             /**< have the bound LPs been solved? */
+   SCIP_Bool*            optimal;            /**< have the bound LPs been solved to optimality? */
+   SCIP_Bool*            filtered;           /**< have the bounds been filtered by the solution of an earlier bound LP? */
+   int**                 genvbcols;          /**< LP positions of the right-hand side variables of the genvbounds */
+   SCIP_Real**           genvbcoefs;         /**< coefficients of the right-hand side variables of the genvbounds */
+   int*                  ngenvbcoefs;        /**< number of right-hand side variables of the genvbounds */
+   SCIP_Real*            genvbconsts;        /**< constants of the genvbounds */
+   SCIP_Real*            genvbcutoffcoefs;   /**< coefficients of the cutoff bound in the genvbounds */
+   SCIP_Bool*            genvbfound;         /**< has a genvbound been found for the bounds? */
+   SCIP_Longint          itlimit;            /**< LP iteration limit of the job (-1: no limit) */
+   SCIP_Longint          nlpiterations;      /**< number of LP iterations used by the job */
+   SCIP_Real             cutoffbound;        /**< cutoff bound of the objective cutoff row */
+   SCIP_Real             epsilon;            /**< absolute values smaller than this are considered zero */
+   SCIP_Real             feastol;            /**< primal feasibility tolerance */
+   SCIP_Real             dualfeastol;        /**< feasibility tolerance for reduced costs */
+   int                   cutoffrowpos;       /**< LP position of the objective cutoff row, or -1 if there is none */
+   int                   nbounds;            /**< number of bounds of the job */
+   int                   ncols;              /**< number of columns of the LP */
+   int                   nrows;              /**< number of rows of the LP */
+   SCIP_Bool             creategenvbounds;   /**< should genvbounds be computed? */
+   SCIP_Bool             applytrivialfilter; /**< should the remaining bounds be filtered by the LP solutions? */
+   SCIP_Bool             tightintbounds;     /**< should bounds of integral variables be tightened in the LP copy? */
+   SCIP_Bool             tightcontbounds;    /**< should bounds of continuous variables be tightened in the LP copy? */
+   SCIP_Bool             error;              /**< did an error occur in the LP solver? */
+};
+typedef struct ObbtJob OBBTJOB;
+
+/** computes the genvbound of the bound with index k of a job from the optimal solution of its bound LP; this is the
+ *  same computation as in createGenVBound(), but on the LP copy of the job
+ */
+static
+SCIP_RETCODE computeGenVBoundJob(
+   OBBTJOB*              job,                /**< OBBT job */
+   int                   k,                  /**< index of the bound in the job */
+   SCIP_Real             objval,             /**< optimal objective value of the bound LP */
+   SCIP_Real*            lbs,                /**< lower bounds of the columns in the LP copy */
+   SCIP_Real*            ubs,                /**< upper bounds of the columns in the LP copy */
+   SCIP_Real*            dualsol,            /**< dual solution of the bound LP */
+   SCIP_Real*            redcost             /**< reduced costs of the bound LP */
+   )
+{
+   SCIP_Real gamma_dual;
+   SCIP_Real c;
+   int ncoefs;
+   int idx;
+   int i;
+
+   assert(job != NULL);
+   assert(0 <= k && k < job->nbounds);
+
+   /* a genvbound with a multiplier for x_i would not help us */
+   if( !EPSZ(redcost[job->colpos[k]], job->epsilon) )
+      return SCIP_OKAY;
+
+   ncoefs = 0;
+   for( i = 0; i < job->ncols; ++i )
+   {
+      if( redcost[i] >= job->dualfeastol || redcost[i] <= -job->dualfeastol )
+         ++ncoefs;
+   }
+
+   /* the objective cutoff is of the form -inf <= obj * x <= cutoff_bound, but we want the positive dual multiplier */
+   gamma_dual = job->cutoffrowpos >= 0 ? -dualsol[job->cutoffrowpos] : 0.0;
+   if( EPSZ(gamma_dual, job->dualfeastol) )
+      gamma_dual = 0.0;
+
+   if( ncoefs == 0 && gamma_dual == 0.0 )
+      return SCIP_OKAY;
+
+   SCIP_ALLOC( BMSallocMemoryArray(&job->genvbcols[k], ncoefs) );
+   SCIP_ALLOC( BMSallocMemoryArray(&job->genvbcoefs[k], ncoefs) );
+
+   c = objval + job->cutoffbound * gamma_dual;
+   idx = 0;
+   for( i = 0; i < job->ncols; ++i )
+   {
+      if( redcost[i] < job->dualfeastol && redcost[i] > -job->dualfeastol )
+         continue;
+
+      /* in this case there is no genvbound */
+      if( (redcost[i] > 0.0 && SCIPlpiIsInfinity(job->lpi, -lbs[i])) || (redcost[i] < 0.0 && SCIPlpiIsInfinity(job->lpi, ubs[i])) )
+         break;
+
+      job->genvbcols[k][idx] = i;
+      job->genvbcoefs[k][idx] = redcost[i];
+      ++idx;
+
+      c -= redcost[i] > 0.0 ? redcost[i] * lbs[i] : redcost[i] * ubs[i];
+   }
+
+   if( idx < ncoefs || SCIPlpiIsInfinity(job->lpi, -c) )
+   {
+      BMSfreeMemoryArray(&job->genvbcoefs[k]);
+      BMSfreeMemoryArray(&job->genvbcols[k]);
+      return SCIP_OKAY;
+   }
+
+   job->ngenvbcoefs[k] = ncoefs;
+   job->genvbconsts[k] = c;
+   job->genvbcutoffcoefs[k] = gamma_dual < job->dualfeastol ? 0.0 : -gamma_dual;
+   job->genvbfound[k] = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** solves the OBBT LPs of the bounds of a job on the job's LP copy */
+static
+SCIP_RETCODE solveObbtJob(
+   void*                 args                /**< OBBT job */
+   )
+{
+   OBBTJOB* job;
+   SCIP_Real* primsol;
+   SCIP_Real* dualsol;
+   SCIP_Real* redcost;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   int k;
+
+   job = (OBBTJOB*) args;
+   assert(job != NULL);
+   assert(job->lpi != NULL);
+
+   SCIP_ALLOC( BMSallocMemoryArray(&primsol, job->ncols) );
+   SCIP_ALLOC( BMSallocMemoryArray(&redcost, job->ncols) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lbs, job->ncols) );
+   SCIP_ALLOC( BMSallocMemoryArray(&ubs, job->ncols) );
+   SCIP_ALLOC( BMSallocMemoryArray(&dualsol, MAX(job->nrows, 1)) );
+
+   SCIP_CALL( SCIPlpiGetBounds(job->lpi, 0, job->ncols - 1, lbs, ubs) );
+
+   for( k = 0; k < job->nbounds && !job->error; ++k )
+   {
+      SCIP_RETCODE retcode;
+      SCIP_Real objcoef;
+      SCIP_Real zero;
+      SCIP_Real objval;
+      int iterations;
+      int col;
+      int j;
+
+      if( job->filtered[k] )
+         continue;
+
+      if( job->itlimit >= 0 && job->nlpiterations >= job->itlimit )
+         break;
+
+      col = job->colpos[k];
+      objcoef = job->bounds[k]->boundtype == SCIP_BOUNDTYPE_LOWER ? 1.0 : -1.0;
+      zero = 0.0;
+
+      SCIP_CALL( SCIPlpiChgObj(job->lpi, 1, &col, &objcoef) );
+      if( job->itlimit >= 0 )
+      {
+         SCIP_CALL( SCIPlpiSetIntpar(job->lpi, SCIP_LPPAR_LPITLIM, (int) MIN(job->itlimit - job->nlpiterations, INT_MAX)) );
+      }
+
+      /* an error in the LP solver should not kill the overall solving process */
+      retcode = SCIPlpiSolvePrimal(job->lpi);
+      job->solved[k] = TRUE;
+
+      if( SCIPlpiGetIterations(job->lpi, &iterations) == SCIP_OKAY )
+         job->nlpiterations += iterations;
+
+      if( retcode != SCIP_OKAY )
+      {
+         job->error = TRUE;
+         break;
+      }
+
+      if( SCIPlpiIsOptimal(job->lpi) )
+      {
+         SCIP_Real newval;
+
+         SCIP_CALL( SCIPlpiGetSol(job->lpi, &objval, primsol, dualsol, NULL, redcost) );
+
+         newval = primsol[col];
+         job->newvals[k] = newval;
+         job->optimal[k] = TRUE;
+
+         if( job->creategenvbounds )
+         {
+            SCIP_CALL( computeGenVBoundJob(job, k, objval, lbs, ubs, dualsol, redcost) );
+         }
+
+         /* tighten the bound in the LP copy to support the remaining bound LPs of this job */
+         if( job->integral[k] ? job->tightintbounds : job->tightcontbounds )
+         {
+            if( job->bounds[k]->boundtype == SCIP_BOUNDTYPE_LOWER )
+            {
+               if( job->integral[k] )
+                  newval = EPSCEIL(newval, job->feastol);
+               newval = MIN(newval, ubs[col]);
+
+               if( EPSGT(newval, lbs[col], job->feastol) )
+               {
+                  lbs[col] = newval;
+                  SCIP_CALL( SCIPlpiChgBounds(job->lpi, 1, &col, &lbs[col], &ubs[col]) );
+               }
+            }
+            else
+            {
+               if( job->integral[k] )
+                  newval = EPSFLOOR(newval, job->feastol);
+               newval = MAX(newval, lbs[col]);
+
+               if( EPSLT(newval, ubs[col], job->feastol) )
+               {
+                  ubs[col] = newval;
+                  SCIP_CALL( SCIPlpiChgBounds(job->lpi, 1, &col, &lbs[col], &ubs[col]) );
+               }
+            }
+         }
+
+         /* filter the remaining bounds of the job that are attained by the current LP solution */
+         if( job->applytrivialfilter )
+         {
+            for( j = k + 1; j < job->nbounds; ++j )
+            {
+               SCIP_Real solval;
+
+               if( job->filtered[j] )
+                  continue;
+
+               solval = primsol[job->colpos[j]];
+
+               if( job->bounds[j]->boundtype == SCIP_BOUNDTYPE_UPPER )
+                  job->filtered[j] = SCIPlpiIsInfinity(job->lpi, solval) || EPSGE(solval, ubs[job->colpos[j]], job->feastol);
+               else
+                  job->filtered[j] = SCIPlpiIsInfinity(job->lpi, -solval) || EPSLE(solval, lbs[job->colpos[j]], job->feastol);
+            }
+         }
+      }
+
+      SCIP_CALL( SCIPlpiChgObj(job->lpi, 1, &col, &zero) );
+   }
+
+   BMSfreeMemoryArray(&dualsol);
+   BMSfreeMemoryArray(&ubs);
+   BMSfreeMemoryArray(&lbs);
+   BMSfreeMemoryArray(&redcost);
+   BMSfreeMemoryArray(&primsol);
+
+   return SCIP_OKAY;
+}
+
+/** sets a real parameter of an LP copy; parameters that are not supported by the LP solver are ignored */
+static
+SCIP_RETCODE setLPIRealpar(
+   SCIP_LPI*             lpi,                /**< LP solver interface */
+   SCIP_LPPARAM          type,               /**< parameter number */
+   SCIP_Real             dval                /**< parameter value */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   retcode = SCIPlpiSetRealpar(lpi, type, dval);
+   if( retcode != SCIP_OKAY && retcode != SCIP_PARAMETERUNKNOWN )
+      return retcode;
+
+   return SCIP_OKAY;
+}
+
+/** creates a copy of the current probing LP in a new LP solver interface and installs the given basis */
+static
+SCIP_RETCODE createProbingLPCopy(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the obbt propagator */
+   SCIP_LPI**            lpi,                /**< pointer to store the LP solver interface */
+   SCIP_LPISTATE*        lpistate            /**< basis of the probing LP, or NULL */
+   )
+{
+   SCIP_COL** cols;
+   SCIP_ROW** rows;
+   SCIP_Real* obj;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   SCIP_Real* lhss;
+   SCIP_Real* rhss;
+   SCIP_Real* vals;
+   SCIP_Real lpiinf;
+   SCIP_Real timelimit;
+   int* beg;
+   int* inds;
+   int nnonz;
+   int ncols;
+   int nrows;
+   int i;
+   int j;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(lpi != NULL);
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+
+   SCIP_CALL( SCIPlpiCreate(lpi, SCIPgetMessagehdlr(scip), "obbt", SCIP_OBJSEN_MINIMIZE) );
+   lpiinf = SCIPlpiInfinity(*lpi);
+
+   /* add the columns with zero objective */
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &obj, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lbs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ubs, ncols) );
+   for( i = 0; i < ncols; ++i )
+   {
+      lbs[i] = SCIPisInfinity(scip, -SCIPcolGetLb(cols[i])) ? -lpiinf : SCIPcolGetLb(cols[i]);
+      ubs[i] = SCIPisInfinity(scip, SCIPcolGetUb(cols[i])) ? lpiinf : SCIPcolGetUb(cols[i]);
+   }
+   SCIP_CALL( SCIPlpiAddCols(*lpi, ncols, obj, lbs, ubs, NULL, 0, NULL, NULL, NULL) );
+   SCIPfreeBufferArray(scip, &ubs);
+   SCIPfreeBufferArray(scip, &lbs);
+   SCIPfreeBufferArray(scip, &obj);
+
+   /* add the rows */
+   nnonz = 0;
+   for( i = 0; i < nrows; ++i )
+      nnonz += SCIProwGetNNonz(rows[i]);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhss, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhss, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &beg, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &inds, nnonz) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vals, nnonz) );
+
+   nnonz = 0;
+   for( i = 0; i < nrows; ++i )
+   {
+      SCIP_COL** rowcols;
+      SCIP_Real* rowvals;
+      SCIP_Real constant;
+
+      rowcols = SCIProwGetCols(rows[i]);
+      rowvals = SCIProwGetVals(rows[i]);
+      constant = SCIProwGetConstant(rows[i]);
+
+      lhss[i] = SCIPisInfinity(scip, -SCIProwGetLhs(rows[i])) ? -lpiinf : SCIProwGetLhs(rows[i]) - constant;
+      rhss[i] = SCIPisInfinity(scip, SCIProwGetRhs(rows[i])) ? lpiinf : SCIProwGetRhs(rows[i]) - constant;
+      beg[i] = nnonz;
+
+      for( j = 0; j < SCIProwGetNNonz(rows[i]); ++j )
+      {
+         if( SCIPcolGetLPPos(rowcols[j]) < 0 )
+            continue;
+
+         inds[nnonz] = SCIPcolGetLPPos(rowcols[j]);
+         vals[nnonz] = rowvals[j];
+         ++nnonz;
+      }
+   }
+   SCIP_CALL( SCIPlpiAddRows(*lpi, nrows, lhss, rhss, NULL, nnonz, beg, inds, vals) );
+
+   SCIPfreeBufferArray(scip, &vals);
+   SCIPfreeBufferArray(scip, &inds);
+   SCIPfreeBufferArray(scip, &beg);
+   SCIPfreeBufferArray(scip, &rhss);
+   SCIPfreeBufferArray(scip, &lhss);
+
+   /* use the tolerances and limits of the probing LP */
+   SCIP_CALL( setLPIRealpar(*lpi, SCIP_LPPAR_FEASTOL, SCIPgetLPFeastol(scip)) );
+   SCIP_CALL( setLPIRealpar(*lpi, SCIP_LPPAR_DUALFEASTOL, SCIPdualfeastol(scip)) );
+   if( propdata->conditionlimit > 0.0 )
+   {
+      SCIP_CALL( setLPIRealpar(*lpi, SCIP_LPPAR_CONDITIONLIMIT, propdata->conditionlimit) );
+   }
+   SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
+   if( !SCIPisInfinity(scip, timelimit) )
+   {
+      SCIP_CALL( setLPIRealpar(*lpi, SCIP_LPPAR_LPTILIM, MAX(timelimit - SCIPgetSolvingTime(scip), 0.0)) );
+   }
+
+   if( lpistate != NULL )
+   {
+      SCIP_CALL( SCIPlpiSetState(*lpi, SCIPblkmem(scip), lpistate) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** finds new variable bounds by solving the OBBT LPs of all unprocessed bounds in parallel
+ *
+ *  The bounds are distributed round-robin among the jobs in the order in which findNewBounds() would consider them:
+ *  first the bounds of nonconvex variables and then the remaining ones, each group sorted by the distance of the LP
+ *  solution to the bound. Every job works on its own copy of the probing LP including the objective cutoff and starts
+ *  from the basis of the probing LP. The results are merged back in the same order, so that the found bounds and
+ *  genvbounds do not depend on the timing of the threads.
+ */
+static
+SCIP_RETCODE findNewBoundsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the obbt propagator */
+   SCIP_Longint*         nleftiterations     /**< pointer to store the number of left iterations */
+   )
+{
+   OBBTJOB* jobs;
+   void** jobargs;
+   BOUND** cands;
+   SCIP_Real* candscores;
+   SCIP_COL** cols;
+   SCIP_LPI* lpi;
+   SCIP_LPISTATE* lpistate;
+   SCIP_RETCODE retcode;
+   SCIP_Longint nolditerations;
+   SCIP_Bool creategenvbounds;
+   SCIP_Bool optimal;
+   SCIP_Bool error;
+   int ncands;
+   int nconvexstart;
+   int ncols;
+   int njobs;
+   int i;
+   int j;
+   int k;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(nleftiterations != NULL);
+   assert(SCIPinProbing(scip));
+
+   /* collect the unprocessed bounds; nonconvex bounds come first as in the two phases of findNewBounds() */
+   SCIP_CALL( SCIPallocBufferArray(scip, &cands, propdata->nbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &candscores, propdata->nbounds) );
+   ncands = 0;
+   for( i = 0; i < propdata->nbounds; ++i )
+   {
+      BOUND* bound = propdata->bounds[i];
+
+      if( !bound->filtered && !bound->done && (bound->nonconvex || bound->indicator) )
+         cands[ncands++] = bound;
+   }
+   nconvexstart = ncands;
+   for( i = 0; i < propdata->nbounds; ++i )
+   {
+      BOUND* bound = propdata->bounds[i];
+
+      if( !bound->filtered && !bound->done && !bound->nonconvex && !bound->indicator )
+         cands[ncands++] = bound;
+   }
+
+   if( ncands == 0 )
+      goto FREECANDS;
+
+   /* sort both groups w.r.t. the distance of the current LP solution to the bound, see nextBound() */
+   if( propdata->orderingalgo != 0 )
+   {
+      for( i = 0; i < ncands; ++i )
+      {
+         candscores[i] = evalBound(scip, cands[i]);
+         if( propdata->orderingalgo == 2 )
+            candscores[i] = -candscores[i];
+      }
+      SCIPsortRealPtr(candscores, (void**) cands, nconvexstart);
+      SCIPsortRealPtr(&candscores[nconvexstart], (void**) &cands[nconvexstart], ncands - nconvexstart);
+   }
+
+   /* solve the probing LP with zero objective once to obtain a basis for the objective cutoff row */
+   nolditerations = SCIPgetNLPIterations(scip);
+   SCIP_CALL( solveLP(scip, -1, &error, &optimal) );
+   propdata->nprobingiterations += SCIPgetNLPIterations(scip) - nolditerations;
+   if( *nleftiterations >= 0 )
+      *nleftiterations = MAX(*nleftiterations - (SCIPgetNLPIterations(scip) - nolditerations), 0);
+
+   if( error || !optimal || *nleftiterations == 0 )
+      goto FREECANDS;
+
+   SCIP_CALL( SCIPgetLPI(scip, &lpi) );
+   SCIP_CALL( SCIPlpiGetState(lpi, SCIPblkmem(scip), &lpistate) );
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+
+   /* only genvbounds created in the root node are globally valid */
+   creategenvbounds = propdata->genvboundprop != NULL && SCIPgetDepth(scip) == 1;
+
+   njobs = MIN(propdata->nthreads, ncands);
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &jobs, njobs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, njobs) );
+
+   for( j = 0; j < njobs; ++j )
+   {
+      OBBTJOB* job = &jobs[j];
+      int nbounds;
+
+      nbounds = (ncands - j + njobs - 1) / njobs;
+
+      job->nbounds = nbounds;
+      job->ncols = ncols;
+      job->nrows = SCIPgetNLPRows(scip);
+      job->itlimit = *nleftiterations >= 0 ? *nleftiterations / njobs : -1;
+      job->cutoffbound = SCIPgetCutoffbound(scip);
+      job->cutoffrowpos = propdata->cutoffrow != NULL ? SCIProwGetLPPos(propdata->cutoffrow) : -1;
+      job->epsilon = SCIPepsilon(scip);
+      job->feastol = SCIPfeastol(scip);
+      job->dualfeastol = SCIPdualfeastol(scip);
+      job->creategenvbounds = creategenvbounds;
+      job->applytrivialfilter = propdata->applytrivialfilter;
+      job->tightintbounds = propdata->tightintboundsprobing;
+      job->tightcontbounds = propdata->tightcontboundsprobing;
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &job->bounds, nbounds) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &job->colpos, nbounds) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &job->integral, nbounds) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &job->newvals, nbounds) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &job->solved, nbounds) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &job->optimal, nbounds) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &job->filtered, nbounds) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &job->genvbcols, nbounds) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &job->genvbcoefs, nbounds) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &job->ngenvbcoefs, nbounds) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &job->genvbconsts, nbounds) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &job->genvbcutoffcoefs, nbounds) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &job->genvbfound, nbounds) );
+
+      for( k = 0; k < nbounds; ++k )
+      {
+         BOUND* bound = cands[k * njobs + j];
+
+         assert(SCIPvarGetStatus(bound->var) == SCIP_VARSTATUS_COLUMN);
+         job->bounds[k] = bound;
+         job->colpos[k] = SCIPcolGetLPPos(SCIPvarGetCol(bound->var));
+         job->integral[k] = SCIPvarIsIntegral(bound->var);
+         assert(job->colpos[k] >= 0);
+      }
+
+      SCIP_CALL( createProbingLPCopy(scip, propdata, &job->lpi, lpistate) );
+      jobargs[j] = (void*) job;
+   }
+
+   SCIP_CALL( SCIPlpiFreeState(lpi, SCIPblkmem(scip), &lpistate) );
+
+   SCIPdebugMsg(scip, "solve OBBT LPs of %d bounds in %d jobs\n", ncands, njobs);
+
+   /* an error in one of the jobs should not kill the overall solving process */
+   retcode = SCIPtpiExecuteJobs(solveObbtJob, jobargs, njobs, propdata->nthreads);
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPwarningMessage(scip, "   error while solving OBBT LPs in parallel; terminated with code <%d>\n", retcode);
+      SCIPwarningMessage(scip, "   this does not affect the remaining solution procedure --> continue\n");
+   }
+
+   /* merge the results in the order of the candidates */
+   for( i = 0; i < ncands && retcode == SCIP_OKAY; ++i )
+   {
+      OBBTJOB* job = &jobs[i % njobs];
+      BOUND* bound;
+
+      k = i / njobs;
+      bound = job->bounds[k];
+      assert(bound == cands[i]);
+
+      if( job->filtered[k] )
+      {
+         bound->filtered = TRUE;
+         ++propdata->ntrivialfiltered;
+         continue;
+      }
+
+      if( !job->solved[k] )
+         continue;
+
+      bound->done = TRUE;
+      ++propdata->nsolvedbounds;
+
+      if( !job->optimal[k] )
+         continue;
+
+      bound->newval = job->newvals[k];
+      bound->found = TRUE;
+
+      if( job->genvbfound[k] )
+      {
+         SCIP_VAR** genvboundvars;
+
+         SCIP_CALL( SCIPallocBufferArray(scip, &genvboundvars, job->ngenvbcoefs[k]) );
+         for( j = 0; j < job->ngenvbcoefs[k]; ++j )
+            genvboundvars[j] = SCIPcolGetVar(cols[job->genvbcols[k][j]]);
+
+         SCIP_CALL( SCIPgenVBoundAdd(scip, propdata->genvboundprop, genvboundvars, bound->var, job->genvbcoefs[k],
+               job->ngenvbcoefs[k], job->genvbcutoffcoefs[k], job->genvbconsts[k], bound->boundtype) );
+         ++propdata->ngenvboundsprobing;
+
+         SCIPfreeBufferArray(scip, &genvboundvars);
+      }
+   }
+
+   /* free the jobs in reverse order of the buffer allocations */
+   for( j = njobs - 1; j >= 0; --j )
+   {
+      OBBTJOB* job = &jobs[j];
+
+      propdata->nprobingiterations += job->nlpiterations;
+      if( *nleftiterations >= 0 )
+         *nleftiterations = MAX(*nleftiterations - job->nlpiterations, 0);
+
+      for( k = 0; k < job->nbounds; ++k )
+      {
+         BMSfreeMemoryArrayNull(&job->genvbcoefs[k]);
+         BMSfreeMemoryArrayNull(&job->genvbcols[k]);
+      }
+
+      SCIP_CALL( SCIPlpiFree(&job->lpi) );
+
+      SCIPfreeBufferArray(scip, &job->genvbfound);
+      SCIPfreeBufferArray(scip, &job->genvbcutoffcoefs);
+      SCIPfreeBufferArray(scip, &job->genvbconsts);
+      SCIPfreeBufferArray(scip, &job->ngenvbcoefs);
+      SCIPfreeBufferArray(scip, &job->genvbcoefs);
+      SCIPfreeBufferArray(scip, &job->genvbcols);
+      SCIPfreeBufferArray(scip, &job->filtered);
+      SCIPfreeBufferArray(scip, &job->optimal);
+      SCIPfreeBufferArray(scip, &job->solved);
+      SCIPfreeBufferArray(scip, &job->newvals);
+      SCIPfreeBufferArray(scip, &job->integral);
+      SCIPfreeBufferArray(scip, &job->colpos);
+      SCIPfreeBufferArray(scip, &job->bounds);
+   }
+   SCIPfreeBufferArray(scip, &jobargs);
+   SCIPfreeBufferArray(scip, &jobs);
+
+FREECANDS:
+   SCIPfreeBufferArray(scip, &candscores);
+   SCIPfreeBufferArray(scip, &cands);
+
+   return SCIP_OKAY;
+}
+
 
 /** main function of obbt */
 static
@@ -2187,12 +2823,21 @@ SCIP_RETCODE applyObbt(
       }
    }
 
-   /* find new bounds for the variables */
-   SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, FALSE) );
-
-   if( nleftiterations > 0 || itlimit < 0 )
+   /* find new bounds for the variables; the parallel version cannot separate the OBBT LP solutions or propagate in
+    * between, because these need the probing LP of SCIP
+    */
+   if( propdata->nthreads > 1 && SCIPtpiIsAvailable() && !propdata->separatesol && propdata->propagatefreq == 0 )
    {
-      SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, TRUE) );
+      SCIP_CALL( findNewBoundsParallel(scip, propdata, &nleftiterations) );
+   }
+   else
+   {
+      SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, FALSE) );
+
+      if( nleftiterations > 0 || itlimit < 0 )
+      {
+         SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, TRUE) );
+      }
    }
 
    /* reset dual feastol and condition limit */
@@ -3455,5 +4100,9 @@ SCIP_RETCODE SCIPincludePropObbt(
         "trigger a propagation round after that many bound tightenings (0: no propagation)",
         &propdata->propagatefreq, TRUE, DEFAULT_PROPAGATEFREQ, 0, INT_MAX, NULL, NULL) );
 
+  SCIP_CALL( SCIPaddIntParam(scip, "propagating/" PROP_NAME "/nthreads",
+        "number of threads used to solve the OBBT LPs, each on its own copy of the probing LP (1: sequential)",
+        &propdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
    return SCIP_OKAY;
 }
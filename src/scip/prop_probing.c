@@ -34,13 +34,17 @@
 
 #include "blockmemshell/memory.h"
 #include "scip/prop_probing.h"
+#include "scip/pub_cons.h"
+#include "scip/pub_implics.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
+#include "scip/pub_misc_linear.h"
 #include "scip/pub_misc_sort.h"
 #include "scip/pub_prop.h"
 #include "scip/pub_tree.h"
 #include "scip/pub_var.h"
 #include "scip/scip_branch.h"
+#include "scip/scip_cons.h"
 #include "scip/scip_general.h"
 #include "scip/scip_lp.h"
 #include "scip/scip_mem.h"
@@ -55,6 +59,7 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #define PROP_NAME               "probing"
@@ -69,6 +74,9 @@
 #define PROP_PRESOL_MAXROUNDS        -1 /**< maximal number of presolving rounds the presolver participates in (-1: no
                                          *   limit) */
 #define MAXDNOM                 10000LL /**< maximal denominator for simple rational fixed values */
+#define PARALLEL_BATCHSIZE           64 /**< number of candidates probed by each thread in one parallel probing batch */
+#define PARALLEL_MAXPROPROUNDS      100 /**< maximal number of propagation rounds in parallel probing if proprounds is -1 */
+#define PARALLEL_MINBOUNDSTEP      1e-3 /**< minimal relative improvement of a continuous bound in parallel probing */
 
 
 /* @todo check for restricting the maximal number of implications that can be added by probing */
@@ -93,6 +101,7 @@
                                          *   (0: don't abort) */
 #define DEFAULT_MAXDEPTH            -1  /**< maximal depth until propagation is executed(-1: no limit) */
 #define DEFAULT_RANDSEED            59  /**< random initial seed */
+#define DEFAULT_NTHREADS             1  /**< number of threads used for probing in presolving (1: sequential) */
 
 /*
  * Data structures
@@ -126,10 +135,84 @@ struct SCIP_PropData
    int                   ntotaluseless;      /**< current number of successive totally useless probings */
    int                   nsumuseless;        /**< current number of useless probings */
    int                   maxdepth;           /**< maximal depth until propagation is executed */
+   int                   nthreads;           /**< number of threads used for probing in presolving (1: sequential) */
    SCIP_Longint          lastnode;           /**< last node where probing was applied, or -1 for presolving, and -2 for not applied yet */
    SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator */
 };
 
+/** propagation-only copy of the linear-type constraints and the domains of the probing variables, which is shared
+ *  read-only by the jobs of parallel probing
+ */
+struct ProbingCopy
+{
+   SCIP_VAR**            vars;               /**< probing variables */
+   int*                  varpos;             /**< position of each variable index in the probing variables, or -1 */
+   SCIP_Real*            lbs;                /**< global lower bounds of the probing variables */
+   SCIP_Real*            ubs;                /**< global upper bounds of the probing variables */
+   SCIP_Bool*            integral;           /**< are the probing variables integral? */
+   SCIP_Bool*            binary;             /**< are the probing variables binary? */
+   int*                  rowbeg;             /**< start of each row in rowpos and rowvals */
+   int*                  rowpos;             /**< positions of the variables of the rows */
+   SCIP_Real*            rowvals;            /**< coefficients of the variables of the rows */
+   SCIP_Real*            lhss;               /**< left-hand sides of the rows */
+   SCIP_Real*            rhss;               /**< right-hand sides of the rows */
+   int*                  colbeg;             /**< start of each variable in colrows */
+   int*                  colrows;            /**< rows of each variable */
+   SCIP_Real             infinity;           /**< value for infinity */
+   SCIP_Real             feastol;            /**< feasibility tolerance */
+   int                   nvars;              /**< number of probing variables */
+   int                   nvarindices;        /**< size of varpos */
+   int                   nrows;              /**< number of rows */
+   int                   maxproprounds;      /**< maximal number of propagation rounds in a probing */
+};
+typedef struct ProbingCopy PROBINGCOPY;
+
+/** job of parallel probing, which probes a subset of the candidates on the shared copy of the problem
+ *
+ *  Probing a candidate to zero and to one yields two probings with indices 2*c and 2*c+1; the bounds changed by
+ *  implications and cliques of probing p are stored in the result arrays at positions implbeg[p] to propbeg[p]-1, the
+ *  bounds after propagation at positions propbeg[p] to implbeg[p+1]-1.
+ */
+struct ProbingJob
+{
+   PROBINGCOPY*          copy;               /**< shared copy of the problem */
+   int*                  cands;              /**< positions of the candidates in the probing variables */
+   int                   ncands;             /**< number of candidates */
+   SCIP_Bool*            cutoff;             /**< did the probings run into infeasibility? */
+   int*                  implbeg;            /**< start of the implied bounds of each probing in the result arrays */
+   int*                  propbeg;            /**< start of the propagated bounds of each probing in the result arrays */
+   int*                  respos;             /**< positions of the variables of the results */
+   SCIP_Real*            reslbs;             /**< lower bounds of the results */
+   SCIP_Real*            resubs;             /**< upper bounds of the results */
+   int                   nres;               /**< number of results */
+   int                   ressize;            /**< size of the result arrays */
+   SCIP_Real*            lbs;                /**< working lower bounds of the job */
+   SCIP_Real*            ubs;                /**< working upper bounds of the job */
+   int*                  changed;            /**< positions of the variables with changed working bounds */
+   SCIP_Bool*            ischanged;          /**< have the working bounds of the variables been changed? */
+   int*                  fixqueue;           /**< binary variables fixed in the working domain whose implications are pending */
+   int*                  rowqueue;           /**< rows to be propagated in the current round */
+   int*                  nextrowqueue;       /**< rows to be propagated in the next round */
+   SCIP_Bool*            rowinqueue;         /**< is the row in the queue of the next round? */
+   int                   nchanged;           /**< number of variables with changed working bounds */
+   int                   nfixqueue;          /**< number of entries in fixqueue */
+   int                   nrowqueue;          /**< number of entries in rowqueue */
+   int                   nnextrowqueue;      /**< number of entries in nextrowqueue */
+};
+typedef struct ProbingJob PROBINGJOB;
+
+/** batch of candidates that have been probed in parallel */
+struct ProbingBatch
+{
+   PROBINGJOB*           jobs;               /**< jobs of the batch */
+   int*                  candjob;            /**< job of each position in the batch range, or -1 if it was not probed */
+   int*                  candidx;            /**< index of each position in the candidates of its job */
+   int                   njobs;              /**< number of jobs */
+   int                   startidx;           /**< first position of the batch range */
+   int                   endidx;             /**< first position after the batch range */
+};
+typedef struct ProbingBatch PROBINGBATCH;
+
 
 /*
  * Local methods
@@ -338,6 +421,928 @@ SCIP_RETCODE sortVariables(
    return SCIP_OKAY;
 }
 
+/** updates the bounds of the copy for parallel probing to the current global bounds */
+static
+void updateProbingCopyBounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PROBINGCOPY*          copy                /**< copy of the problem for parallel probing */
+   )
+{
+   int j;
+
+   assert(copy != NULL);
+
+   for( j = 0; j < copy->nvars; ++j )
+   {
+      SCIP_Real lb;
+      SCIP_Real ub;
+
+      lb = SCIPvarGetLbGlobal(copy->vars[j]);
+      ub = SCIPvarGetUbGlobal(copy->vars[j]);
+
+      copy->lbs[j] = SCIPisInfinity(scip, -lb) ? -copy->infinity : lb;
+      copy->ubs[j] = SCIPisInfinity(scip, ub) ? copy->infinity : ub;
+   }
+}
+
+/** creates the propagation-only copy of the linear-type constraints for parallel probing
+ *
+ *  Only the constraints of the linear, setppc, logicor, knapsack, and varbound constraint handlers are copied as rows;
+ *  constraints containing variables that are neither fixed nor one of the probing variables are skipped. Since the
+ *  copy is a relaxation of the problem, every deduction of the parallel probing is valid.
+ */
+static
+SCIP_RETCODE createProbingCopy(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            vars,               /**< probing variables */
+   int                   nvars,              /**< number of probing variables */
+   int                   proprounds,         /**< maximal number of propagation rounds (-1: no limit) */
+   PROBINGCOPY**         copy                /**< pointer to store the copy of the problem */
+   )
+{
+   const char* conshdlrnames[] = { "linear", "setppc", "logicor", "knapsack", "varbound" };
+   SCIP_VAR** consvars;
+   SCIP_Real* consvals;
+   int* colcount;
+   int consvarssize;
+   int rowssize;
+   int nnzsize;
+   int nnz;
+   int h;
+   int j;
+   int k;
+
+   assert(copy != NULL);
+
+   SCIP_CALL( SCIPallocMemory(scip, copy) );
+   (*copy)->vars = vars;
+   (*copy)->nvars = nvars;
+   (*copy)->nvarindices = SCIPgetNTotalVars(scip);
+   (*copy)->infinity = SCIPinfinity(scip);
+   (*copy)->feastol = SCIPfeastol(scip);
+   (*copy)->maxproprounds = proprounds >= 0 ? proprounds : PARALLEL_MAXPROPROUNDS;
+   (*copy)->nrows = 0;
+
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->varpos, (*copy)->nvarindices) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->lbs, nvars) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->ubs, nvars) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->integral, nvars) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->binary, nvars) );
+
+   for( j = 0; j < (*copy)->nvarindices; ++j )
+      (*copy)->varpos[j] = -1;
+
+   for( j = 0; j < nvars; ++j )
+   {
+      assert(SCIPvarGetIndex(vars[j]) < (*copy)->nvarindices);
+
+      (*copy)->varpos[SCIPvarGetIndex(vars[j])] = j;
+      (*copy)->integral[j] = SCIPvarIsIntegral(vars[j]);
+      (*copy)->binary[j] = SCIPvarIsBinary(vars[j]);
+   }
+
+   updateProbingCopyBounds(scip, *copy);
+
+   /* collect the rows */
+   rowssize = 0;
+   for( h = 0; h < (int)(sizeof(conshdlrnames) / sizeof(conshdlrnames[0])); ++h )
+   {
+      SCIP_CONSHDLR* conshdlr = SCIPfindConshdlr(scip, conshdlrnames[h]);
+
+      if( conshdlr != NULL )
+         rowssize += SCIPconshdlrGetNConss(conshdlr);
+   }
+
+   nnzsize = SCIPcalcMemGrowSize(scip, 2 * rowssize + 1);
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->rowbeg, rowssize + 1) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->lhss, rowssize + 1) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->rhss, rowssize + 1) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->rowpos, nnzsize) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->rowvals, nnzsize) );
+
+   consvarssize = 0;
+   consvars = NULL;
+   consvals = NULL;
+   nnz = 0;
+
+   for( h = 0; h < (int)(sizeof(conshdlrnames) / sizeof(conshdlrnames[0])); ++h )
+   {
+      SCIP_CONSHDLR* conshdlr;
+      SCIP_CONS** conss;
+      int nconss;
+      int c;
+
+      conshdlr = SCIPfindConshdlr(scip, conshdlrnames[h]);
+      if( conshdlr == NULL )
+         continue;
+
+      conss = SCIPconshdlrGetConss(conshdlr);
+      nconss = SCIPconshdlrGetNConss(conshdlr);
+
+      for( c = 0; c < nconss; ++c )
+      {
+         SCIP_CONS* cons = conss[c];
+         SCIP_Bool success;
+         SCIP_Real lhs;
+         SCIP_Real rhs;
+         int nconsvars;
+         int rowstart;
+
+         if( SCIPconsIsModifiable(cons) || SCIPconsIsDeleted(cons) )
+            continue;
+
+         SCIP_CALL( SCIPgetConsNVars(scip, cons, &nconsvars, &success) );
+         if( !success || nconsvars == 0 )
+            continue;
+
+         if( nconsvars > consvarssize )
+         {
+            consvarssize = SCIPcalcMemGrowSize(scip, nconsvars);
+            SCIP_CALL( SCIPreallocBufferArray(scip, &consvars, consvarssize) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &consvals, consvarssize) );
+         }
+
+         SCIP_CALL( SCIPgetConsVars(scip, cons, consvars, consvarssize, &success) );
+         if( !success )
+            continue;
+
+         SCIP_CALL( SCIPgetConsVals(scip, cons, consvals, consvarssize, &success) );
+         if( !success )
+            continue;
+
+         lhs = SCIPconsGetLhs(scip, cons, &success);
+         if( !success )
+            continue;
+
+         rhs = SCIPconsGetRhs(scip, cons, &success);
+         if( !success )
+            continue;
+
+         if( nnz + nconsvars > nnzsize )
+         {
+            nnzsize = SCIPcalcMemGrowSize(scip, nnz + nconsvars);
+            SCIP_CALL( SCIPreallocMemoryArray(scip, &(*copy)->rowpos, nnzsize) );
+            SCIP_CALL( SCIPreallocMemoryArray(scip, &(*copy)->rowvals, nnzsize) );
+         }
+
+         /* transform the row to the probing variables and move the constants of fixed variables to the sides */
+         rowstart = nnz;
+         for( k = 0; k < nconsvars; ++k )
+         {
+            SCIP_VAR* var;
+            SCIP_Real scalar;
+            SCIP_Real constant;
+            int idx;
+
+            var = consvars[k];
+            scalar = 1.0;
+            constant = 0.0;
+            SCIP_CALL( SCIPgetProbvarSum(scip, &var, &scalar, &constant) );
+
+            if( SCIPisInfinity(scip, REALABS(constant)) )
+               break;
+
+            if( !SCIPisInfinity(scip, -lhs) )
+               lhs -= consvals[k] * constant;
+            if( !SCIPisInfinity(scip, rhs) )
+               rhs -= consvals[k] * constant;
+
+            if( scalar == 0.0 )
+               continue;
+
+            idx = SCIPvarIsActive(var) ? SCIPvarGetIndex(var) : -1;
+            if( idx < 0 || idx >= (*copy)->nvarindices || (*copy)->varpos[idx] < 0 )
+               break;
+
+            (*copy)->rowpos[nnz] = (*copy)->varpos[idx];
+            (*copy)->rowvals[nnz] = consvals[k] * scalar;
+            ++nnz;
+         }
+
+         /* skip rows with unknown variables and empty rows */
+         if( k < nconsvars || nnz == rowstart )
+         {
+            nnz = rowstart;
+            continue;
+         }
+
+         assert((*copy)->nrows < rowssize);
+         (*copy)->rowbeg[(*copy)->nrows] = rowstart;
+         (*copy)->lhss[(*copy)->nrows] = SCIPisInfinity(scip, -lhs) ? -(*copy)->infinity : lhs;
+         (*copy)->rhss[(*copy)->nrows] = SCIPisInfinity(scip, rhs) ? (*copy)->infinity : rhs;
+         ++(*copy)->nrows;
+      }
+   }
+   (*copy)->rowbeg[(*copy)->nrows] = nnz;
+
+   SCIPfreeBufferArrayNull(scip, &consvals);
+   SCIPfreeBufferArrayNull(scip, &consvars);
+
+   /* create the column-wise index of the rows */
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->colbeg, nvars + 1) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &(*copy)->colrows, MAX(nnz, 1)) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &colcount, nvars + 1) );
+
+   for( k = 0; k < nnz; ++k )
+      ++colcount[(*copy)->rowpos[k] + 1];
+
+   (*copy)->colbeg[0] = 0;
+   for( j = 0; j < nvars; ++j )
+   {
+      (*copy)->colbeg[j + 1] = (*copy)->colbeg[j] + colcount[j + 1];
+      colcount[j + 1] = (*copy)->colbeg[j];
+   }
+
+   for( h = 0; h < (*copy)->nrows; ++h )
+   {
+      for( k = (*copy)->rowbeg[h]; k < (*copy)->rowbeg[h + 1]; ++k )
+         (*copy)->colrows[colcount[(*copy)->rowpos[k] + 1]++] = h;
+   }
+
+   SCIPfreeBufferArray(scip, &colcount);
+
+   SCIPdebugMsg(scip, "created copy for parallel probing with %d rows and %d nonzeros\n", (*copy)->nrows, nnz);
+
+   return SCIP_OKAY;
+}
+
+/** frees the copy of the problem for parallel probing */
+static
+void freeProbingCopy(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PROBINGCOPY**         copy                /**< pointer to the copy of the problem */
+   )
+{
+   assert(copy != NULL);
+
+   if( *copy == NULL )
+      return;
+
+   SCIPfreeMemoryArray(scip, &(*copy)->colrows);
+   SCIPfreeMemoryArray(scip, &(*copy)->colbeg);
+   SCIPfreeMemoryArray(scip, &(*copy)->rowvals);
+   SCIPfreeMemoryArray(scip, &(*copy)->rowpos);
+   SCIPfreeMemoryArray(scip, &(*copy)->rhss);
+   SCIPfreeMemoryArray(scip, &(*copy)->lhss);
+   SCIPfreeMemoryArray(scip, &(*copy)->rowbeg);
+   SCIPfreeMemoryArray(scip, &(*copy)->binary);
+   SCIPfreeMemoryArray(scip, &(*copy)->integral);
+   SCIPfreeMemoryArray(scip, &(*copy)->ubs);
+   SCIPfreeMemoryArray(scip, &(*copy)->lbs);
+   SCIPfreeMemoryArray(scip, &(*copy)->varpos);
+   SCIPfreeMemory(scip, copy);
+}
+
+/** changes a working bound of a parallel probing job and enqueues the affected rows and implications */
+static
+void changeJobBound(
+   PROBINGJOB*           job,                /**< parallel probing job */
+   int                   pos,                /**< position of the variable */
+   SCIP_Real             newbound,           /**< new bound */
+   SCIP_BOUNDTYPE        boundtype           /**< type of the bound */
+   )
+{
+   PROBINGCOPY* copy = job->copy;
+   int k;
+
+   if( !job->ischanged[pos] )
+   {
+      job->ischanged[pos] = TRUE;
+      job->changed[job->nchanged++] = pos;
+   }
+
+   if( boundtype == SCIP_BOUNDTYPE_LOWER )
+      job->lbs[pos] = newbound;
+   else
+      job->ubs[pos] = newbound;
+
+   for( k = copy->colbeg[pos]; k < copy->colbeg[pos + 1]; ++k )
+   {
+      int r = copy->colrows[k];
+
+      if( !job->rowinqueue[r] )
+      {
+         job->rowinqueue[r] = TRUE;
+         job->nextrowqueue[job->nnextrowqueue++] = r;
+      }
+   }
+
+   /* each binary variable is fixed at most once per probing, so the queue cannot overflow */
+   if( copy->binary[pos] && (job->lbs[pos] > 0.5 || job->ubs[pos] < 0.5) )
+      job->fixqueue[job->nfixqueue++] = pos;
+}
+
+/** tightens a working bound of a parallel probing job if the new bound is a sufficient improvement
+ *
+ *  @return FALSE if the domain of the variable became empty, TRUE otherwise
+ */
+static
+SCIP_Bool tightenJobBound(
+   PROBINGJOB*           job,                /**< parallel probing job */
+   int                   pos,                /**< position of the variable */
+   SCIP_Real             newbound,           /**< new bound */
+   SCIP_BOUNDTYPE        boundtype           /**< type of the bound */
+   )
+{
+   PROBINGCOPY* copy = job->copy;
+   SCIP_Real lb = job->lbs[pos];
+   SCIP_Real ub = job->ubs[pos];
+
+   if( REALABS(newbound) >= copy->infinity )
+      return TRUE;
+
+   if( boundtype == SCIP_BOUNDTYPE_LOWER )
+   {
+      if( copy->integral[pos] )
+      {
+         newbound = ceil(newbound - copy->feastol);
+         if( newbound < lb + 0.5 )
+            return TRUE;
+      }
+      else if( lb > -copy->infinity && newbound <= lb + PARALLEL_MINBOUNDSTEP * MAX(1.0, REALABS(lb)) )
+         return TRUE;
+
+      if( newbound > ub + copy->feastol )
+         return FALSE;
+
+      changeJobBound(job, pos, MIN(newbound, ub), SCIP_BOUNDTYPE_LOWER);
+   }
+   else
+   {
+      if( copy->integral[pos] )
+      {
+         newbound = floor(newbound + copy->feastol);
+         if( newbound > ub - 0.5 )
+            return TRUE;
+      }
+      else if( ub < copy->infinity && newbound >= ub - PARALLEL_MINBOUNDSTEP * MAX(1.0, REALABS(ub)) )
+         return TRUE;
+
+      if( newbound < lb - copy->feastol )
+         return FALSE;
+
+      changeJobBound(job, pos, MAX(newbound, lb), SCIP_BOUNDTYPE_UPPER);
+   }
+
+   return TRUE;
+}
+
+/** applies the implications and cliques of the fixed binary variables in the queue of a parallel probing job
+ *
+ *  @return FALSE if infeasibility was detected, TRUE otherwise
+ */
+static
+SCIP_Bool propagateJobImplications(
+   PROBINGJOB*           job                 /**< parallel probing job */
+   )
+{
+   PROBINGCOPY* copy = job->copy;
+
+   while( job->nfixqueue > 0 )
+   {
+      SCIP_VAR* var;
+      SCIP_VAR** implvars;
+      SCIP_BOUNDTYPE* impltypes;
+      SCIP_Real* implbounds;
+      SCIP_CLIQUE** cliques;
+      SCIP_Bool fixval;
+      int nimpls;
+      int ncliques;
+      int pos;
+      int k;
+
+      pos = job->fixqueue[--job->nfixqueue];
+      var = copy->vars[pos];
+      fixval = job->lbs[pos] > 0.5;
+
+      /* the implication and clique data is only read, the main thread waits for the jobs */
+      nimpls = SCIPvarGetNImpls(var, fixval);
+      implvars = SCIPvarGetImplVars(var, fixval);
+      impltypes = SCIPvarGetImplTypes(var, fixval);
+      implbounds = SCIPvarGetImplBounds(var, fixval);
+
+      for( k = 0; k < nimpls; ++k )
+      {
+         int idx = SCIPvarGetIndex(implvars[k]);
+
+         if( idx < 0 || idx >= copy->nvarindices || copy->varpos[idx] < 0 )
+            continue;
+
+         if( !tightenJobBound(job, copy->varpos[idx], implbounds[k], impltypes[k]) )
+            return FALSE;
+      }
+
+      ncliques = SCIPvarGetNCliques(var, fixval);
+      cliques = SCIPvarGetCliques(var, fixval);
+
+      for( k = 0; k < ncliques; ++k )
+      {
+         SCIP_VAR** cliquevars;
+         SCIP_Bool* cliquevals;
+         int ncliquevars;
+         int l;
+
+         cliquevars = SCIPcliqueGetVars(cliques[k]);
+         cliquevals = SCIPcliqueGetValues(cliques[k]);
+         ncliquevars = SCIPcliqueGetNVars(cliques[k]);
+
+         /* all other literals of the clique have to be zero */
+         for( l = 0; l < ncliquevars; ++l )
+         {
+            int idx;
+
+            if( cliquevars[l] == var )
+               continue;
+
+            idx = SCIPvarGetIndex(cliquevars[l]);
+            if( idx < 0 || idx >= copy->nvarindices || copy->varpos[idx] < 0 )
+               continue;
+
+            if( !tightenJobBound(job, copy->varpos[idx], cliquevals[l] ? 0.0 : 1.0,
+                  cliquevals[l] ? SCIP_BOUNDTYPE_UPPER : SCIP_BOUNDTYPE_LOWER) )
+               return FALSE;
+         }
+      }
+   }
+
+   return TRUE;
+}
+
+/** propagates a row of the copy on the working bounds of a parallel probing job by its activity bounds
+ *
+ *  @return FALSE if infeasibility was detected, TRUE otherwise
+ */
+static
+SCIP_Bool propagateJobRow(
+   PROBINGJOB*           job,                /**< parallel probing job */
+   int                   r                   /**< row to propagate */
+   )
+{
+   PROBINGCOPY* copy = job->copy;
+   SCIP_Real minact;
+   SCIP_Real maxact;
+   SCIP_Real lhs;
+   SCIP_Real rhs;
+   int nmininf;
+   int nmaxinf;
+   int k;
+
+   lhs = copy->lhss[r];
+   rhs = copy->rhss[r];
+   minact = 0.0;
+   maxact = 0.0;
+   nmininf = 0;
+   nmaxinf = 0;
+
+   for( k = copy->rowbeg[r]; k < copy->rowbeg[r + 1]; ++k )
+   {
+      SCIP_Real val = copy->rowvals[k];
+      SCIP_Real lb = job->lbs[copy->rowpos[k]];
+      SCIP_Real ub = job->ubs[copy->rowpos[k]];
+
+      if( val > 0.0 )
+      {
+         if( lb <= -copy->infinity )
+            ++nmininf;
+         else
+            minact += val * lb;
+         if( ub >= copy->infinity )
+            ++nmaxinf;
+         else
+            maxact += val * ub;
+      }
+      else
+      {
+         if( ub >= copy->infinity )
+            ++nmininf;
+         else
+            minact += val * ub;
+         if( lb <= -copy->infinity )
+            ++nmaxinf;
+         else
+            maxact += val * lb;
+      }
+   }
+
+   if( nmininf == 0 && rhs < copy->infinity && minact > rhs + copy->feastol * MAX(1.0, REALABS(rhs)) )
+      return FALSE;
+   if( nmaxinf == 0 && lhs > -copy->infinity && maxact < lhs - copy->feastol * MAX(1.0, REALABS(lhs)) )
+      return FALSE;
+
+   /* nothing can be deduced if more than one contribution to the relevant activity bound is infinite */
+   if( (rhs >= copy->infinity || nmininf > 1) && (lhs <= -copy->infinity || nmaxinf > 1) )
+      return TRUE;
+
+   for( k = copy->rowbeg[r]; k < copy->rowbeg[r + 1]; ++k )
+   {
+      SCIP_Real val = copy->rowvals[k];
+      SCIP_Real lb = job->lbs[copy->rowpos[k]];
+      SCIP_Real ub = job->ubs[copy->rowpos[k]];
+      SCIP_Real mincontr;
+      SCIP_Real maxcontr;
+      SCIP_Real residual;
+
+      mincontr = val > 0.0 ? lb : ub;
+      maxcontr = val > 0.0 ? ub : lb;
+
+      /* rhs: val * x <= rhs - (minimal activity of the other entries) */
+      if( rhs < copy->infinity )
+      {
+         SCIP_Bool mininf = REALABS(mincontr) >= copy->infinity;
+
+         if( nmininf == 0 || (nmininf == 1 && mininf) )
+         {
+            residual = mininf ? minact : minact - val * mincontr;
+
+            if( !tightenJobBound(job, copy->rowpos[k], (rhs - residual) / val,
+                  val > 0.0 ? SCIP_BOUNDTYPE_UPPER : SCIP_BOUNDTYPE_LOWER) )
+               return FALSE;
+         }
+      }
+
+      /* lhs: val * x >= lhs - (maximal activity of the other entries) */
+      if( lhs > -copy->infinity )
+      {
+         SCIP_Bool maxinf = REALABS(maxcontr) >= copy->infinity;
+
+         if( nmaxinf == 0 || (nmaxinf == 1 && maxinf) )
+         {
+            residual = maxinf ? maxact : maxact - val * maxcontr;
+
+            if( !tightenJobBound(job, copy->rowpos[k], (lhs - residual) / val,
+                  val > 0.0 ? SCIP_BOUNDTYPE_LOWER : SCIP_BOUNDTYPE_UPPER) )
+               return FALSE;
+         }
+      }
+   }
+
+   return TRUE;
+}
+
+/** probes the fixing of a candidate on the working bounds of a parallel probing job and stores the changed bounds */
+static
+SCIP_RETCODE probeJobCandidate(
+   PROBINGJOB*           job,                /**< parallel probing job */
+   int                   pos,                /**< position of the candidate */
+   SCIP_Bool             fixone,             /**< should the candidate be fixed to one (or zero)? */
+   int                   probing             /**< index of the probing in the result arrays */
+   )
+{
+   PROBINGCOPY* copy = job->copy;
+   SCIP_Bool feasible;
+   int round;
+   int k;
+
+   /* make sure that the results of the probing fit into the result arrays */
+   if( job->nres + 2 * copy->nvars > job->ressize )
+   {
+      job->ressize = MAX(2 * job->ressize, job->nres + 2 * copy->nvars);
+      SCIP_ALLOC( BMSreallocMemoryArray(&job->respos, job->ressize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&job->reslbs, job->ressize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&job->resubs, job->ressize) );
+   }
+
+   changeJobBound(job, pos, fixone ? 1.0 : 0.0, fixone ? SCIP_BOUNDTYPE_LOWER : SCIP_BOUNDTYPE_UPPER);
+
+   /* apply implications and cliques */
+   feasible = propagateJobImplications(job);
+
+   job->implbeg[probing] = job->nres;
+   if( feasible )
+   {
+      for( k = 0; k < job->nchanged; ++k )
+      {
+         job->respos[job->nres] = job->changed[k];
+         job->reslbs[job->nres] = job->lbs[job->changed[k]];
+         job->resubs[job->nres] = job->ubs[job->changed[k]];
+         ++job->nres;
+      }
+   }
+   job->propbeg[probing] = job->nres;
+
+   /* propagate the rows and the implications of newly fixed binary variables in rounds */
+   for( round = 0; feasible && round < copy->maxproprounds && job->nnextrowqueue > 0; ++round )
+   {
+      int* tmp;
+
+      tmp = job->rowqueue;
+      job->rowqueue = job->nextrowqueue;
+      job->nextrowqueue = tmp;
+      job->nrowqueue = job->nnextrowqueue;
+      job->nnextrowqueue = 0;
+
+      for( k = 0; k < job->nrowqueue; ++k )
+         job->rowinqueue[job->rowqueue[k]] = FALSE;
+
+      for( k = 0; k < job->nrowqueue && feasible; ++k )
+      {
+         feasible = propagateJobRow(job, job->rowqueue[k]);
+
+         if( feasible )
+            feasible = propagateJobImplications(job);
+      }
+   }
+
+   job->cutoff[probing] = !feasible;
+   if( feasible )
+   {
+      for( k = 0; k < job->nchanged; ++k )
+      {
+         job->respos[job->nres] = job->changed[k];
+         job->reslbs[job->nres] = job->lbs[job->changed[k]];
+         job->resubs[job->nres] = job->ubs[job->changed[k]];
+         ++job->nres;
+      }
+   }
+   else
+      job->nres = job->implbeg[probing];
+
+   /* reset the working bounds and the queues */
+   for( k = 0; k < job->nchanged; ++k )
+   {
+      int j = job->changed[k];
+
+      job->lbs[j] = copy->lbs[j];
+      job->ubs[j] = copy->ubs[j];
+      job->ischanged[j] = FALSE;
+   }
+   for( k = 0; k < job->nnextrowqueue; ++k )
+      job->rowinqueue[job->nextrowqueue[k]] = FALSE;
+
+   job->nchanged = 0;
+   job->nfixqueue = 0;
+   job->nrowqueue = 0;
+   job->nnextrowqueue = 0;
+
+   return SCIP_OKAY;
+}
+
+/** executes a parallel probing job: probes each candidate of the job to zero and to one on its own copy of the domains */
+static
+SCIP_RETCODE probingJob(
+   void*                 args                /**< parallel probing job */
+   )
+{
+   PROBINGJOB* job = (PROBINGJOB*) args;
+   PROBINGCOPY* copy;
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   int c;
+
+   assert(job != NULL);
+   copy = job->copy;
+
+   /* the working memory is allocated in the thread, block and buffer memory of SCIP must not be used here */
+   if( BMSduplicateMemoryArray(&job->lbs, copy->lbs, copy->nvars) == NULL
+      || BMSduplicateMemoryArray(&job->ubs, copy->ubs, copy->nvars) == NULL
+      || BMSallocMemoryArray(&job->changed, copy->nvars) == NULL
+      || BMSallocClearMemoryArray(&job->ischanged, copy->nvars) == NULL
+      || BMSallocMemoryArray(&job->fixqueue, copy->nvars) == NULL
+      || BMSallocMemoryArray(&job->rowqueue, MAX(copy->nrows, 1)) == NULL
+      || BMSallocMemoryArray(&job->nextrowqueue, MAX(copy->nrows, 1)) == NULL
+      || BMSallocClearMemoryArray(&job->rowinqueue, MAX(copy->nrows, 1)) == NULL )
+   {
+      retcode = SCIP_NOMEMORY;
+      goto TERMINATE;
+   }
+
+   job->nchanged = 0;
+   job->nfixqueue = 0;
+   job->nrowqueue = 0;
+   job->nnextrowqueue = 0;
+
+   for( c = 0; c < job->ncands && retcode == SCIP_OKAY; ++c )
+   {
+      retcode = probeJobCandidate(job, job->cands[c], FALSE, 2 * c);
+
+      if( retcode == SCIP_OKAY )
+         retcode = probeJobCandidate(job, job->cands[c], TRUE, 2 * c + 1);
+   }
+   job->implbeg[2 * job->ncands] = job->nres;
+
+TERMINATE:
+   BMSfreeMemoryArrayNull(&job->rowinqueue);
+   BMSfreeMemoryArrayNull(&job->nextrowqueue);
+   BMSfreeMemoryArrayNull(&job->rowqueue);
+   BMSfreeMemoryArrayNull(&job->fixqueue);
+   BMSfreeMemoryArrayNull(&job->ischanged);
+   BMSfreeMemoryArrayNull(&job->changed);
+   BMSfreeMemoryArrayNull(&job->ubs);
+   BMSfreeMemoryArrayNull(&job->lbs);
+
+   return retcode;
+}
+
+/** frees the results of a parallel probing batch */
+static
+void freeProbingBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PROBINGBATCH*         batch               /**< parallel probing batch */
+   )
+{
+   int j;
+
+   assert(batch != NULL);
+
+   if( batch->jobs == NULL )
+      return;
+
+   for( j = batch->njobs - 1; j >= 0; --j )
+   {
+      PROBINGJOB* job = &batch->jobs[j];
+
+      BMSfreeMemoryArrayNull(&job->resubs);
+      BMSfreeMemoryArrayNull(&job->reslbs);
+      BMSfreeMemoryArrayNull(&job->respos);
+      SCIPfreeMemoryArray(scip, &job->propbeg);
+      SCIPfreeMemoryArray(scip, &job->implbeg);
+      SCIPfreeMemoryArray(scip, &job->cutoff);
+      SCIPfreeMemoryArray(scip, &job->cands);
+   }
+
+   SCIPfreeMemoryArray(scip, &batch->candidx);
+   SCIPfreeMemoryArray(scip, &batch->candjob);
+   SCIPfreeMemoryArray(scip, &batch->jobs);
+   batch->njobs = 0;
+   batch->startidx = -1;
+   batch->endidx = -1;
+}
+
+/** probes the unfixed active binary variables at the positions startidx to endidx-1 in parallel on the copy of the
+ *  problem; an error in the jobs only leaves the batch empty, in which case the candidates are probed sequentially
+ */
+static
+SCIP_RETCODE probeBatchParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   PROBINGCOPY*          copy,               /**< copy of the problem for parallel probing */
+   int                   startidx,           /**< first position of the batch */
+   int                   endidx,             /**< first position after the batch */
+   PROBINGBATCH*         batch               /**< parallel probing batch to fill */
+   )
+{
+   SCIP_RETCODE retcode;
+   void** jobargs;
+   int* cands;
+   int ncands;
+   int i;
+   int j;
+
+   assert(copy != NULL);
+   assert(batch != NULL);
+   assert(batch->jobs == NULL);
+   assert(startidx < endidx);
+
+   batch->startidx = startidx;
+   batch->endidx = endidx;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &cands, endidx - startidx) );
+
+   ncands = 0;
+   for( i = startidx; i < endidx; ++i )
+   {
+      SCIP_VAR* var = copy->vars[i];
+
+      if( SCIPvarIsActive(var) && !SCIPvarIsDeleted(var) && SCIPvarGetLbGlobal(var) < 0.5
+         && SCIPvarGetUbGlobal(var) > 0.5 )
+         cands[ncands++] = i;
+   }
+
+   if( ncands == 0 )
+   {
+      SCIPfreeBufferArray(scip, &cands);
+      return SCIP_OKAY;
+   }
+
+   updateProbingCopyBounds(scip, copy);
+
+   batch->njobs = MIN(propdata->nthreads, ncands);
+   SCIP_CALL( SCIPallocClearMemoryArray(scip, &batch->jobs, batch->njobs) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &batch->candjob, endidx - startidx) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &batch->candidx, endidx - startidx) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, batch->njobs) );
+
+   for( i = 0; i < endidx - startidx; ++i )
+      batch->candjob[i] = -1;
+
+   for( j = 0; j < batch->njobs; ++j )
+   {
+      PROBINGJOB* job = &batch->jobs[j];
+
+      job->copy = copy;
+      job->ncands = (ncands - j + batch->njobs - 1) / batch->njobs;
+      SCIP_CALL( SCIPallocMemoryArray(scip, &job->cands, job->ncands) );
+      SCIP_CALL( SCIPallocMemoryArray(scip, &job->cutoff, 2 * job->ncands) );
+      SCIP_CALL( SCIPallocMemoryArray(scip, &job->implbeg, 2 * job->ncands + 1) );
+      SCIP_CALL( SCIPallocMemoryArray(scip, &job->propbeg, 2 * job->ncands) );
+      jobargs[j] = (void*) job;
+   }
+
+   /* assign the candidates to the jobs in a round-robin fashion */
+   for( i = 0; i < ncands; ++i )
+   {
+      j = i % batch->njobs;
+      batch->jobs[j].cands[i / batch->njobs] = cands[i];
+      batch->candjob[cands[i] - startidx] = j;
+      batch->candidx[cands[i] - startidx] = i / batch->njobs;
+   }
+
+   SCIPdebugMsg(scip, "probing %d candidates in %d parallel jobs\n", ncands, batch->njobs);
+
+   retcode = SCIPtpiExecuteJobs(probingJob, jobargs, batch->njobs, propdata->nthreads);
+
+   SCIPfreeBufferArray(scip, &jobargs);
+   SCIPfreeBufferArray(scip, &cands);
+
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPwarningMessage(scip, "   error while probing in parallel; terminated with code <%d>\n", retcode);
+      SCIPwarningMessage(scip, "   this does not affect the remaining solution procedure --> continue\n");
+
+      freeProbingBatch(scip, batch);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** gets the result of probing the variable at position i in a parallel probing batch in the format of
+ *  SCIPapplyProbingVar(); the bounds are intersected with the current bounds, since these might have been tightened
+ *  after the batch was probed
+ *
+ *  @return FALSE if the variable has not been probed in the batch, TRUE otherwise
+ */
+static
+SCIP_Bool getParallelProbingResult(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PROBINGBATCH*         batch,              /**< parallel probing batch */
+   SCIP_VAR**            vars,               /**< problem variables */
+   int                   nvars,              /**< number of problem variables */
+   int                   i,                  /**< position of the probing variable */
+   SCIP_Bool             fixone,             /**< get the result of fixing the variable to one (or zero)? */
+   SCIP_Real*            impllbs,            /**< array to store lower bounds after applying implications and cliques */
+   SCIP_Real*            implubs,            /**< array to store upper bounds after applying implications and cliques */
+   SCIP_Real*            proplbs,            /**< array to store lower bounds after full propagation */
+   SCIP_Real*            propubs,            /**< array to store upper bounds after full propagation */
+   SCIP_Bool*            cutoff              /**< pointer to store whether the probing direction is infeasible */
+   )
+{
+   PROBINGJOB* job;
+   int probing;
+   int k;
+   int j;
+
+   assert(batch != NULL);
+   assert(cutoff != NULL);
+
+   if( batch->jobs == NULL || i < batch->startidx || i >= batch->endidx || batch->candjob[i - batch->startidx] < 0 )
+      return FALSE;
+
+   job = &batch->jobs[batch->candjob[i - batch->startidx]];
+   probing = 2 * batch->candidx[i - batch->startidx] + (fixone ? 1 : 0);
+   assert(job->cands[probing / 2] == i);
+
+   *cutoff = job->cutoff[probing];
+   if( *cutoff )
+      return TRUE;
+
+   for( j = 0; j < nvars; ++j )
+   {
+      impllbs[j] = SCIPvarGetLbLocal(vars[j]);
+      implubs[j] = SCIPvarGetUbLocal(vars[j]);
+      proplbs[j] = impllbs[j];
+      propubs[j] = implubs[j];
+   }
+
+   for( k = job->implbeg[probing]; k < job->implbeg[probing + 1]; ++k )
+   {
+      SCIP_Real* lbs;
+      SCIP_Real* ubs;
+      SCIP_Real lb;
+      SCIP_Real ub;
+
+      j = job->respos[k];
+      if( !SCIPvarIsActive(vars[j]) )
+         continue;
+
+      lbs = k < job->propbeg[probing] ? impllbs : proplbs;
+      ubs = k < job->propbeg[probing] ? implubs : propubs;
+
+      lb = MAX(lbs[j], job->reslbs[k]);
+      ub = MIN(ubs[j], job->resubs[k]);
+
+      /* the deductions of the batch contradict the current bounds, so the probing direction is infeasible */
+      if( SCIPisFeasGT(scip, lb, ub) )
+      {
+         *cutoff = TRUE;
+         return TRUE;
+      }
+
+      lbs[j] = MIN(lb, ub);
+      ubs[j] = ub;
+   }
+
+   return TRUE;
+}
+
 /** the main probing loop */
 static
 SCIP_RETCODE applyProbing(
@@ -364,6 +1369,8 @@ SCIP_RETCODE applyProbing(
    SCIP_Real* oneimplubs;
    SCIP_Real* oneproplbs;
    SCIP_Real* onepropubs;
+   PROBINGCOPY* copy;
+   PROBINGBATCH batch;
    int localnfixedvars;
    int localnaggrvars;
    int localnchgbds;
@@ -376,6 +1383,7 @@ SCIP_RETCODE applyProbing(
    int oldstartidx;
    SCIP_Bool aborted;
    SCIP_Bool looped;
+   SCIP_Bool parallel;
 
    assert(vars != NULL);
    assert(nbinvars > 0);
@@ -389,6 +1397,13 @@ SCIP_RETCODE applyProbing(
    oldstartidx = *startidx;
    i = *startidx;
 
+   /* in presolving, the candidates can be probed in parallel on a propagation-only copy of the problem */
+   parallel = propdata->nthreads > 1 && SCIPtpiIsAvailable() && SCIPgetStage(scip) == SCIP_STAGE_PRESOLVING;
+   copy = NULL;
+   BMSclearMemory(&batch);
+   batch.startidx = -1;
+   batch.endidx = -1;
+
    /* get temporary memory for storing probing results */
    SCIP_CALL( SCIPallocBufferArray(scip, &zeroimpllbs, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &zeroimplubs, nvars) );
@@ -481,6 +1496,20 @@ SCIP_RETCODE applyProbing(
          propdata->nuseless++;
          propdata->ntotaluseless++;
 
+         /* probe the next batch of candidates in parallel; the results are used in the order of the candidates */
+         if( parallel && (i < batch.startidx || i >= batch.endidx) )
+         {
+            freeProbingBatch(scip, &batch);
+
+            if( copy == NULL )
+            {
+               SCIP_CALL( createProbingCopy(scip, vars, nvars, propdata->proprounds, &copy) );
+            }
+
+            SCIP_CALL( probeBatchParallel(scip, propdata, copy, i, MIN(nbinvars, i + propdata->nthreads * PARALLEL_BATCHSIZE),
+                  &batch) );
+         }
+
          /* determine whether one probing should happen */
          probingone = TRUE;
          if( SCIPvarGetNLocksUpType(vars[i], SCIP_LOCKTYPE_MODEL) == 0 )
@@ -488,9 +1517,13 @@ SCIP_RETCODE applyProbing(
 
          if( probingone )
          {
-            /* apply probing for fixing the variable to one */
-            SCIP_CALL( SCIPapplyProbingVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_LOWER, 1.0, propdata->proprounds,
-                  oneimpllbs, oneimplubs, oneproplbs, onepropubs, &localcutoff) );
+            /* apply probing for fixing the variable to one, unless it has been probed in parallel */
+            if( !getParallelProbingResult(scip, &batch, vars, nvars, i, TRUE, oneimpllbs, oneimplubs, oneproplbs,
+                  onepropubs, &localcutoff) )
+            {
+               SCIP_CALL( SCIPapplyProbingVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_LOWER, 1.0, propdata->proprounds,
+                     oneimpllbs, oneimplubs, oneproplbs, onepropubs, &localcutoff) );
+            }
 
             if( localcutoff )
             {
@@ -540,9 +1573,13 @@ SCIP_RETCODE applyProbing(
 
          if( probingzero )
          {
-            /* apply probing for fixing the variable to zero */
-            SCIP_CALL( SCIPapplyProbingVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_UPPER, 0.0, propdata->proprounds,
-                  zeroimpllbs, zeroimplubs, zeroproplbs, zeropropubs, &localcutoff) );
+            /* apply probing for fixing the variable to zero, unless it has been probed in parallel */
+            if( !getParallelProbingResult(scip, &batch, vars, nvars, i, FALSE, zeroimpllbs, zeroimplubs, zeroproplbs,
+                  zeropropubs, &localcutoff) )
+            {
+               SCIP_CALL( SCIPapplyProbingVar(scip, vars, nvars, i, SCIP_BOUNDTYPE_UPPER, 0.0, propdata->proprounds,
+                     zeroimpllbs, zeroimplubs, zeroproplbs, zeropropubs, &localcutoff) );
+            }
 
             if( localcutoff )
             {
@@ -623,6 +1660,10 @@ SCIP_RETCODE applyProbing(
             "   (%.1fs) probing cycle finished: starting next cycle\n", SCIPgetSolvingTime(scip));
          i = 0;
 
+         /* the variables are collected anew, so the parallel probing data has to be recreated */
+         freeProbingBatch(scip, &batch);
+         freeProbingCopy(scip, &copy);
+
          if( SCIPgetStage(scip) == SCIP_STAGE_PRESOLVING )
          {
             SCIP_VAR** newvars;
@@ -712,6 +1753,8 @@ SCIP_RETCODE applyProbing(
 
  TERMINATE:
    /* free temporary memory */
+   freeProbingBatch(scip, &batch);
+   freeProbingCopy(scip, &copy);
    SCIPfreeBufferArray(scip, &onepropubs);
    SCIPfreeBufferArray(scip, &oneproplbs);
    SCIPfreeBufferArray(scip, &oneimplubs);
@@ -1193,6 +2236,10 @@ SCIP_RETCODE SCIPincludePropProbing(
          "propagating/" PROP_NAME "/maxdepth",
          "maximal depth until propagation is executed(-1: no limit)",
          &propdata->maxdepth, TRUE, DEFAULT_MAXDEPTH, -1, INT_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "propagating/" PROP_NAME "/nthreads",
+         "number of threads used for probing in presolving on a propagation-only copy of the linear-type constraints (1: sequential)",
+         &propdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
 
    return SCIP_OKAY;
 }
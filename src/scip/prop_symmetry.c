@@ -52,6 +52,10 @@
  * We do not copy symmetry information, since it is not clear how this information transfers. Moreover, copying
  * symmetry might inhibit heuristics. But note that solving a sub-SCIP might then happen without symmetry information!
  *
+ * If the parameter propagating/symmetry/cachedir is set, the generators are stored in a file of this directory whose
+ * name is a hash value of the colored symmetry detection graph. If a later solve produces a graph with the same hash
+ * value, the generators are read from this file instead of being recomputed.
+ *
  *
  * @section SYMBREAK Symmetry handling by the (unified) symmetry handling constraints
  *
@@ -158,6 +162,13 @@
 #define DEFAULT_DOUBLEEQUATIONS     FALSE    /**< Double equations to positive/negative version? */
 #define DEFAULT_COMPRESSSYMMETRIES   TRUE    /**< Should non-affected variables be removed from permutation to save memory? */
 #define DEFAULT_COMPRESSTHRESHOLD     0.5    /**< Compression is used if percentage of moved vars is at most the threshold. */
+#define DEFAULT_NTHREADS                1    /**< maximal number of threads used for computing the colors of the symmetry detection graph (1: sequential) */
+#define DEFAULT_CACHEDIR              "-"    /**< directory of the on-disk cache of symmetry generators ("-": no cache) */
+
+/* symmetry cache */
+#define SYMCACHE_HEADER      "SCIP symmetry cache 1" /**< first line of symmetry cache files */
+#define SYMCACHE_FILESEED    UINT64_C(0x5c1b5e7a1d5eed01) /**< seed of the graph hash value used as file name */
+#define SYMCACHE_CHECKSEED   UINT64_C(0x3f84d5b5b5470917) /**< seed of the graph hash value stored in the file */
 #define DEFAULT_SYMFIXNONBINARYVARS FALSE    /**< Disabled parameter */
 #define DEFAULT_ENFORCECOMPUTESYMMETRY FALSE /**< always compute symmetries, even if they cannot be handled */
 #define DEFAULT_SYMTYPE (int) SYM_SYMTYPE_PERM /**< type of symmetries to be computed */
@@ -264,6 +275,8 @@ struct SCIP_PropData
 
    /* for symmetry computation */
    int                   maxgenerators;      /**< limit on the number of generators that should be produced within symmetry detection (0 = no limit) */
+   int                   nthreads;           /**< maximal number of threads used for computing the colors of the symmetry detection graph */
+   char*                 cachedir;           /**< directory of the on-disk cache of symmetry generators ("-": no cache) */
    SCIP_Bool             checksymmetries;    /**< Should all symmetries be checked after computation? */
    SCIP_Bool             displaynorbitvars;  /**< Whether the number of variables in non-trivial orbits shall be computed */
    SCIP_Bool             compresssymmetries; /**< Should non-affected variables be removed from permutation to save memory? */
@@ -1797,6 +1810,229 @@ SCIP_RETCODE checkSymmetriesAreSymmetries(
    return SCIP_OKAY;
 }
 
+/** gets the name of the file of the symmetry cache that stores the generators of a symmetry detection graph */
+static
+void getSymmetryCacheFilename(
+   SYM_GRAPH*            graph,              /**< symmetry detection graph with computed colors */
+   const char*           cachedir,           /**< directory of the symmetry cache */
+   char*                 filename            /**< buffer of length SCIP_MAXSTRLEN to store the file name */
+   )
+{
+   assert( graph != NULL );
+   assert( cachedir != NULL );
+   assert( filename != NULL );
+
+   (void) SCIPsnprintf(filename, SCIP_MAXSTRLEN, "%s/%016llx.sym", cachedir,
+      (unsigned long long) SCIPgetSymgraphHash(graph, SYMCACHE_FILESEED));
+}
+
+/** checks whether a permutation read from the symmetry cache is an automorphism candidate of the variable nodes */
+static
+SCIP_RETCODE checkSymmetryCachePerm(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SYM_GRAPH*            graph,              /**< symmetry detection graph with computed colors */
+   int*                  perm,               /**< permutation of the variable nodes */
+   int                   permlen,            /**< length of the permutation */
+   SCIP_Bool*            valid               /**< pointer to store whether the permutation is valid */
+   )
+{
+   SCIP_Bool* covered;
+   int i;
+
+   assert( perm != NULL );
+   assert( valid != NULL );
+
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &covered, permlen) );
+
+   *valid = TRUE;
+   for (i = 0; i < permlen && *valid; ++i)
+   {
+      if ( perm[i] < 0 || perm[i] >= permlen || covered[perm[i]] )
+         *valid = FALSE;
+      else if ( SCIPgetSymgraphVarnodeColor(graph, i) != SCIPgetSymgraphVarnodeColor(graph, perm[i]) )
+         *valid = FALSE;
+      else
+         covered[perm[i]] = TRUE;
+   }
+
+   SCIPfreeBufferArray(scip, &covered);
+
+   return SCIP_OKAY;
+}
+
+/** reads the generators of a symmetry detection graph from the symmetry cache
+ *
+ *  The cache entry is only used if it has been computed for a graph with the same hash values and sizes and with the
+ *  same limit on the number of generators, and if all generators map variable nodes to nodes of the same color.
+ */
+static
+SCIP_RETCODE readSymmetryCache(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SYM_GRAPH*            graph,              /**< symmetry detection graph with computed colors */
+   const char*           cachedir,           /**< directory of the symmetry cache */
+   int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   int***                perms,              /**< pointer to store permutation matrix (nperms x permlen) */
+   int*                  nperms,             /**< pointer to store number of permutations */
+   int*                  nmaxperms,          /**< pointer to store maximal number of permutations */
+   SCIP_Real*            log10groupsize,     /**< pointer to store log10 of size of group */
+   SCIP_Bool*            success             /**< pointer to store whether the generators were read from the cache */
+   )
+{
+   char filename[SCIP_MAXSTRLEN];
+   char line[SCIP_MAXSTRLEN];
+   unsigned long long checkhash;
+   FILE* file;
+   int nfileperms;
+   int nsymvars;
+   int nnodes;
+   int nedges;
+   int symtype;
+   int maxgens;
+   int permlen;
+   int p;
+   int i;
+
+   assert( scip != NULL );
+   assert( graph != NULL );
+   assert( perms != NULL );
+   assert( nperms != NULL );
+   assert( nmaxperms != NULL );
+   assert( log10groupsize != NULL );
+   assert( success != NULL );
+
+   *success = FALSE;
+
+   getSymmetryCacheFilename(graph, cachedir, filename);
+   file = fopen(filename, "r");
+   if ( file == NULL )
+      return SCIP_OKAY;
+
+   permlen = SCIPgetSymgraphSymtype(graph) == SYM_SYMTYPE_PERM ? SCIPgetSymgraphNVars(graph) : 2 * SCIPgetSymgraphNVars(graph);
+
+   /* check header */
+   if ( fgets(line, (int) sizeof(line), file) == NULL || strncmp(line, SYMCACHE_HEADER, strlen(SYMCACHE_HEADER)) != 0
+      || fscanf(file, "%llx %d %d %d %d %d", &checkhash, &symtype, &nsymvars, &nnodes, &nedges, &maxgens) != 6
+      || checkhash != (unsigned long long) SCIPgetSymgraphHash(graph, SYMCACHE_CHECKSEED)
+      || symtype != (int) SCIPgetSymgraphSymtype(graph) || nsymvars != SCIPgetSymgraphNVars(graph)
+      || nnodes != SCIPgetSymgraphNNodes(graph) || nedges != SCIPgetSymgraphNEdges(graph) || maxgens != maxgenerators
+      || fscanf(file, "%d %lf", &nfileperms, log10groupsize) != 2 || nfileperms < 0
+      || (maxgenerators > 0 && nfileperms > maxgenerators) )
+   {
+      SCIPdebugMsg(scip, "ignoring symmetry cache file <%s> of a different graph\n", filename);
+      (void) fclose(file);
+      *log10groupsize = 0.0;
+      return SCIP_OKAY;
+   }
+
+   /* read generators */
+   *perms = NULL;
+   if ( nfileperms > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, perms, nfileperms) );
+   }
+
+   *success = TRUE;
+   for (p = 0; p < nfileperms && *success; ++p)
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*perms)[p], permlen) );
+
+      for (i = 0; i < permlen && *success; ++i)
+      {
+         if ( fscanf(file, "%d", &(*perms)[p][i]) != 1 )
+            *success = FALSE;
+      }
+
+      if ( *success )
+      {
+         SCIP_CALL( checkSymmetryCachePerm(scip, graph, (*perms)[p], permlen, success) );
+      }
+   }
+   /* now p is the number of allocated generators */
+
+   if ( *success && (fscanf(file, "%15s", line) != 1 || strcmp(line, "end") != 0) )
+      *success = FALSE;
+
+   (void) fclose(file);
+
+   if ( ! *success )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) ignoring corrupted symmetry cache file <%s>\n",
+         SCIPgetSolvingTime(scip), filename);
+
+      for (i = p - 1; i >= 0; --i)
+      {
+         SCIPfreeBlockMemoryArray(scip, &(*perms)[i], permlen);
+      }
+      SCIPfreeBlockMemoryArrayNull(scip, perms, nfileperms);
+      *log10groupsize = 0.0;
+
+      return SCIP_OKAY;
+   }
+
+   *nperms = nfileperms;
+   *nmaxperms = nfileperms;
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "   (%.1fs) read %d generators from symmetry cache file <%s>\n",
+      SCIPgetSolvingTime(scip), nfileperms, filename);
+
+   return SCIP_OKAY;
+}
+
+/** writes the generators of a symmetry detection graph to the symmetry cache */
+static
+SCIP_RETCODE writeSymmetryCache(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SYM_GRAPH*            graph,              /**< symmetry detection graph with computed colors */
+   const char*           cachedir,           /**< directory of the symmetry cache */
+   int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   int**                 perms,              /**< permutation matrix (nperms x permlen) */
+   int                   nperms,             /**< number of permutations */
+   SCIP_Real             log10groupsize      /**< log10 of size of group */
+   )
+{
+   char filename[SCIP_MAXSTRLEN];
+   FILE* file;
+   int permlen;
+   int p;
+   int i;
+
+   assert( scip != NULL );
+   assert( graph != NULL );
+   assert( perms != NULL || nperms == 0 );
+
+   getSymmetryCacheFilename(graph, cachedir, filename);
+   file = fopen(filename, "w");
+   if ( file == NULL )
+   {
+      SCIPwarningMessage(scip, "cannot write symmetry cache file <%s>\n", filename);
+      return SCIP_OKAY;
+   }
+
+   permlen = SCIPgetSymgraphSymtype(graph) == SYM_SYMTYPE_PERM ? SCIPgetSymgraphNVars(graph) : 2 * SCIPgetSymgraphNVars(graph);
+
+   (void) fprintf(file, "%s\n", SYMCACHE_HEADER);
+   (void) fprintf(file, "%016llx %d %d %d %d %d\n", (unsigned long long) SCIPgetSymgraphHash(graph, SYMCACHE_CHECKSEED),
+      (int) SCIPgetSymgraphSymtype(graph), SCIPgetSymgraphNVars(graph), SCIPgetSymgraphNNodes(graph),
+      SCIPgetSymgraphNEdges(graph), maxgenerators);
+   (void) fprintf(file, "%d %.17g\n", nperms, log10groupsize);
+
+   for (p = 0; p < nperms; ++p)
+   {
+      for (i = 0; i < permlen; ++i)
+         (void) fprintf(file, i == 0 ? "%d" : " %d", perms[p][i]);
+      (void) fprintf(file, "\n");
+   }
+   (void) fprintf(file, "end\n");
+
+   if ( fclose(file) != 0 )
+   {
+      SCIPwarningMessage(scip, "error while writing symmetry cache file <%s>\n", filename);
+      (void) remove(filename);
+   }
+
+   return SCIP_OKAY;
+}
+
 /** computes symmetry group of a CIP */
 static
 SCIP_RETCODE computeSymmetryGroup(
@@ -1805,6 +2041,8 @@ SCIP_RETCODE computeSymmetryGroup(
    SCIP_Bool             compresssymmetries, /**< Should non-affected variables be removed from permutation to save memory? */
    SCIP_Real             compressthreshold,  /**< if percentage of moved vars is at most threshold, compression is done */
    int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
+   int                   nthreads,           /**< maximal number of threads used for computing the colors of the graph */
+   const char*           cachedir,           /**< directory of the symmetry cache ("-": no cache) */
    SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
    SCIP_Bool             checksymmetries,    /**< Should all symmetries be checked after computation? */
    SCIP_VAR***           permvars,           /**< pointer to permvars array */
@@ -1827,6 +2065,7 @@ SCIP_RETCODE computeSymmetryGroup(
 {
    SCIP_CONS** conss;
    SYM_GRAPH* graph;
+   SCIP_Bool cachehit = FALSE;
    int nconsnodes = 0;
    int nvalnodes = 0;
    int nopnodes = 0;
@@ -1908,7 +2147,7 @@ SCIP_RETCODE computeSymmetryGroup(
       }
    }
 
-   SCIP_CALL( SCIPcomputeSymgraphColors(scip, graph, fixedtype) );
+   SCIP_CALL( SCIPcomputeSymgraphColorsParallel(scip, graph, fixedtype, nthreads) );
 
    /* terminate early in case all variables are different */
    if ( (symtype == SYM_SYMTYPE_PERM && SCIPgetSymgraphNVarcolors(graph) == SCIPgetNVars(scip))
@@ -1921,8 +2160,22 @@ SCIP_RETCODE computeSymmetryGroup(
    /*
     * actually compute symmetries
     */
-   SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, graph, nperms, nmaxperms,
-         perms, log10groupsize, symcodetime) );
+   if ( cachedir[0] != '-' )
+   {
+      SCIP_CALL( readSymmetryCache(scip, graph, cachedir, maxgenerators, perms, nperms, nmaxperms, log10groupsize,
+            &cachehit) );
+   }
+
+   if ( ! cachehit )
+   {
+      SCIP_CALL( SYMcomputeSymmetryGenerators(scip, maxgenerators, graph, nperms, nmaxperms,
+            perms, log10groupsize, symcodetime) );
+
+      if ( cachedir[0] != '-' )
+      {
+         SCIP_CALL( writeSymmetryCache(scip, graph, cachedir, maxgenerators, *perms, *nperms, *log10groupsize) );
+      }
+   }
 
    if ( checksymmetries && *nperms > 0 )
    {
@@ -2361,7 +2614,7 @@ SCIP_RETCODE determineSymmetry(
    /* actually compute (global) symmetry */
    SCIP_CALL( computeSymmetryGroup(scip, (SYM_SYMTYPE) propdata->symtype,
          propdata->compresssymmetries, propdata->compressthreshold,
-         maxgenerators, symspecrequirefixed, propdata->checksymmetries, &propdata->permvars,
+         maxgenerators, propdata->nthreads, propdata->cachedir, symspecrequirefixed, propdata->checksymmetries, &propdata->permvars,
          &propdata->npermvars, &propdata->nbinpermvars, &propdata->permvardomaincenter,
          &propdata->isproperperm, &propdata->perms, &propdata->nperms, &propdata->nmaxperms,
          &propdata->nmovedvars, &propdata->binvaraffected, &propdata->compressed,
@@ -7915,6 +8168,16 @@ SCIP_RETCODE SCIPincludePropSymmetry(
          "limit on the number of generators that should be produced within symmetry detection (0 = no limit)",
          &propdata->maxgenerators, TRUE, DEFAULT_MAXGENERATORS, 0, INT_MAX, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "propagating/" PROP_NAME "/nthreads",
+         "maximal number of threads used for computing the colors of the symmetry detection graph (1: sequential)",
+         &propdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddStringParam(scip,
+         "propagating/" PROP_NAME "/cachedir",
+         "directory of the on-disk cache of symmetry generators, which are reused for graphs with the same colored structure ('-': no cache)",
+         &propdata->cachedir, TRUE, DEFAULT_CACHEDIR, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/checksymmetries",
          "Should all symmetries be checked after computation?",
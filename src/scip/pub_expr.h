@@ -124,6 +124,13 @@ void SCIPexprhdlrSetDiff(
    SCIP_DECL_EXPRBWFWDIFF((*bwfwdiff))       /**< backward-forward derivative evaluation callback (can be NULL) */
 );
 
+/** set the batched point evaluation callback of an expression handler */
+SCIP_EXPORT
+void SCIPexprhdlrSetEvalBatch(
+   SCIP_EXPRHDLR*        exprhdlr,           /**< expression handler */
+   SCIP_DECL_EXPREVALBATCH((*evalbatch))     /**< batched point evaluation callback (can be NULL) */
+);
+
 /** set the interval evaluation callback of an expression handler */
 SCIP_EXPORT
 void SCIPexprhdlrSetIntEval(
@@ -202,6 +209,12 @@ SCIP_Bool SCIPexprhdlrHasFwdiff(
    SCIP_EXPRHDLR*        exprhdlr            /**< expression handler */
    );
 
+/** returns whether expression handler implements the batched point evaluation callback */
+SCIP_EXPORT
+SCIP_Bool SCIPexprhdlrHasEvalBatch(
+   SCIP_EXPRHDLR*        exprhdlr            /**< expression handler */
+   );
+
 /** returns whether expression handler implements the interval evaluation callback */
 SCIP_EXPORT
 SCIP_Bool SCIPexprhdlrHasIntEval(
@@ -369,6 +382,7 @@ SCIP_Longint SCIPexprhdlrGetNSimplifications(
 #define SCIPexprhdlrSetHash(exprhdlr, hash_)                 (exprhdlr)->hash = hash_
 #define SCIPexprhdlrSetCompare(exprhdlr, compare_)           (exprhdlr)->compare = compare_
 #define SCIPexprhdlrSetDiff(exprhdlr, bwdiff_, fwdiff_, bwfwdiff_) do { (exprhdlr)->bwdiff = bwdiff_; (exprhdlr)->fwdiff = fwdiff_; (exprhdlr)->bwfwdiff = bwfwdiff_; } while (FALSE)
+#define SCIPexprhdlrSetEvalBatch(exprhdlr, evalbatch_)       (exprhdlr)->evalbatch = evalbatch_
 #define SCIPexprhdlrSetIntEval(exprhdlr, inteval_)           (exprhdlr)->inteval = inteval_
 #define SCIPexprhdlrSetSimplify(exprhdlr, simplify_)         (exprhdlr)->simplify = simplify_
 #define SCIPexprhdlrSetReverseProp(exprhdlr, reverseprop_)   (exprhdlr)->reverseprop = reverseprop_
@@ -381,6 +395,7 @@ SCIP_Longint SCIPexprhdlrGetNSimplifications(
 #define SCIPexprhdlrHasPrint(exprhdlr)             ((exprhdlr)->print != NULL)
 #define SCIPexprhdlrHasBwdiff(exprhdlr)            ((exprhdlr)->bwdiff != NULL)
 #define SCIPexprhdlrHasFwdiff(exprhdlr)            ((exprhdlr)->fwdiff != NULL)
+#define SCIPexprhdlrHasEvalBatch(exprhdlr)         ((exprhdlr)->evalbatch != NULL)
 #define SCIPexprhdlrHasIntEval(exprhdlr)           ((exprhdlr)->inteval != NULL)
 #define SCIPexprhdlrHasEstimate(exprhdlr)          ((exprhdlr)->estimate != NULL)
 #define SCIPexprhdlrHasInitEstimates(exprhdlr)     ((exprhdlr)->initestimates != NULL)
@@ -115,6 +115,36 @@ SCIP_Bool SCIPheurUsesSubscip(
    SCIP_HEUR*            heur                /**< primal heuristic */
    );
 
+/** marks whether the primal heuristic can be executed asynchronously on a copy of the problem
+ *
+ *  Such a heuristic must only rely on the problem and the solutions of the SCIP instance it is called for, since the
+ *  copy is solved in a separate thread; see the async heuristic.
+ */
+SCIP_EXPORT
+void SCIPheurSetAsync(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_Bool             async               /**< can the heuristic be executed asynchronously? */
+   );
+
+/** can the primal heuristic be executed asynchronously on a copy of the problem? */
+SCIP_EXPORT
+SCIP_Bool SCIPheurIsAsync(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   );
+
+/** sets whether the primal heuristic is delegated to an asynchronous worker and thus not executed at the nodes */
+SCIP_EXPORT
+void SCIPheurSetDelegated(
+   SCIP_HEUR*            heur,               /**< primal heuristic */
+   SCIP_Bool             delegated           /**< is the heuristic delegated to an asynchronous worker? */
+   );
+
+/** is the primal heuristic delegated to an asynchronous worker and thus not executed at the nodes? */
+SCIP_EXPORT
+SCIP_Bool SCIPheurIsDelegated(
+   SCIP_HEUR*            heur                /**< primal heuristic */
+   );
+
 /** gets priority of primal heuristic */
 SCIP_EXPORT
 int SCIPheurGetPriority(
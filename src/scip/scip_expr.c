@@ -952,10 +952,13 @@ SCIP_EXPRHDLR* SCIPgetExprhdlrPower(
 #undef SCIPisExprPower
 #undef SCIPprintExpr
 #undef SCIPevalExpr
+#undef SCIPevalExprBatch
 #undef SCIPgetExprNewSoltag
 #undef SCIPevalExprGradient
 #undef SCIPevalExprHessianDir
 #undef SCIPevalExprActivity
+#undef SCIPcompileExpr
+#undef SCIPfreeExprTape
 #undef SCIPcompareExpr
 #undef SCIPsimplifyExpr
 #undef SCIPcallExprCurvature
@@ -1236,7 +1239,7 @@ SCIP_RETCODE SCIPappendExprChild(
    assert(scip != NULL);
    assert(scip->mem != NULL);
 
-   SCIP_CALL( SCIPexprAppendChild(scip->set, scip->mem->probmem, expr, child) );
+   SCIP_CALL( SCIPexprAppendChild(scip->set, scip->stat, scip->mem->probmem, expr, child) );
 
    return SCIP_OKAY;
 }
@@ -1647,6 +1650,36 @@ SCIP_RETCODE SCIPevalExpr(
    return SCIP_OKAY;
 }
 
+/** evaluates an expression at a block of points
+ *
+ * The values of the variables are given in structure-of-arrays layout, that is, varvals[i * npoints + p] is the
+ * value of the variable with index i at point p, where the indices of the variables are given by varidxs or, if
+ * varidxs is NULL, are the problem indices of the variables (see SCIPvarGetProbindex()).
+ * The values of the expression at the points are stored in vals, with SCIP_INVALID for points where an evaluation
+ * error (division by zero, ...) occurred.
+ *
+ * Evaluation loops over the points for every subexpression, using the batched evaluation callbacks of the expression
+ * handlers where available, and is thus much faster than calling SCIPevalExpr() for every point.
+ * The values stored in the expressions (see SCIPexprGetEvalValue()) are not changed.
+ */
+SCIP_RETCODE SCIPevalExprBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   int                   npoints,            /**< number of points */
+   SCIP_HASHMAP*         varidxs,            /**< map from variables to indices in varvals, or NULL to use problem indices */
+   SCIP_Real*            varvals,            /**< values of variables at the points */
+   SCIP_Real*            vals                /**< buffer to store the values of the expression at the points */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIP_CALL( SCIPexprEvalBatch(scip->set, scip->stat, scip->mem->probmem, scip->mem->buffer, expr, npoints, varidxs,
+         varvals, vals) );
+
+   return SCIP_OKAY;
+}
+
 /** returns a previously unused solution tag for expression evaluation */
 SCIP_Longint SCIPgetExprNewSoltag(
    SCIP*                 scip                /**< SCIP data structure */
@@ -1727,6 +1760,44 @@ SCIP_RETCODE SCIPevalExprActivity(
    return SCIP_OKAY;
 }
 
+/** compiles an expression into an evaluation tape
+ *
+ * The tape stores the subexpressions of the expression in topological order.
+ * Afterwards, SCIPevalExpr(), SCIPevalExprGradient(), SCIPevalExprHessianDir(), and SCIPevalExprActivity() (if the
+ * owner does not overwrite the activity evaluation) evaluate the expression by looping over the tape, which is faster
+ * for expressions that are evaluated often. The values of all subexpressions are still stored in the subexpressions.
+ *
+ * The tape is recompiled automatically if the children of any expression are changed.
+ * It is freed together with the expression or by SCIPfreeExprTape().
+ *
+ * @note Partial derivatives of the expression w.r.t. subexpressions that are not variables are summed up over all paths
+ *   from the expression to the subexpression when evaluating the gradient on a tape.
+ */
+SCIP_RETCODE SCIPcompileExpr(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr                /**< expression */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIP_CALL( SCIPexprCompile(scip->set, scip->stat, scip->mem->probmem, expr) );
+
+   return SCIP_OKAY;
+}
+
+/** frees the evaluation tape of an expression, if it has been compiled */
+void SCIPfreeExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr                /**< expression */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->mem != NULL);
+
+   SCIPexprFreeTape(scip->mem->probmem, expr);
+}
+
 /** compare expressions
  * @return -1, 0 or 1 if expr1 <, =, > expr2, respectively
  * @note The given expressions are assumed to be simplified.
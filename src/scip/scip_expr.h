@@ -431,6 +431,28 @@ SCIP_RETCODE SCIPevalExpr(
    SCIP_Longint          soltag              /**< tag that uniquely identifies the solution (with its values), or 0. */
    );
 
+/** evaluates an expression at a block of points
+ *
+ * The values of the variables are given in structure-of-arrays layout, that is, varvals[i * npoints + p] is the
+ * value of the variable with index i at point p, where the indices of the variables are given by varidxs or, if
+ * varidxs is NULL, are the problem indices of the variables (see SCIPvarGetProbindex()).
+ * The values of the expression at the points are stored in vals, with SCIP_INVALID for points where an evaluation
+ * error (division by zero, ...) occurred.
+ *
+ * Evaluation loops over the points for every subexpression, using the batched evaluation callbacks of the expression
+ * handlers where available, and is thus much faster than calling SCIPevalExpr() for every point.
+ * The values stored in the expressions (see SCIPexprGetEvalValue()) are not changed.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPevalExprBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr,               /**< expression to be evaluated */
+   int                   npoints,            /**< number of points */
+   SCIP_HASHMAP*         varidxs,            /**< map from variables to indices in varvals, or NULL to use problem indices */
+   SCIP_Real*            varvals,            /**< values of variables at the points */
+   SCIP_Real*            vals                /**< buffer to store the values of the expression at the points */
+   );
+
 /** returns a previously unused solution tag for expression evaluation */
 SCIP_EXPORT
 SCIP_Longint SCIPgetExprNewSoltag(
@@ -595,6 +617,32 @@ SCIP_RETCODE SCIPevalExprActivity(
    SCIP_EXPR*            expr                /**< expression */
    );
 
+/** compiles an expression into an evaluation tape
+ *
+ * The tape stores the subexpressions of the expression in topological order.
+ * Afterwards, SCIPevalExpr(), SCIPevalExprGradient(), SCIPevalExprHessianDir(), and SCIPevalExprActivity() (if the
+ * owner does not overwrite the activity evaluation) evaluate the expression by looping over the tape, which is faster
+ * for expressions that are evaluated often. The values of all subexpressions are still stored in the subexpressions.
+ *
+ * The tape is recompiled automatically if the children of any expression are changed.
+ * It is freed together with the expression or by SCIPfreeExprTape().
+ *
+ * @note Partial derivatives of the expression w.r.t. subexpressions that are not variables are summed up over all paths
+ *   from the expression to the subexpression when evaluating the gradient on a tape.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcompileExpr(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr                /**< expression */
+   );
+
+/** frees the evaluation tape of an expression, if it has been compiled */
+SCIP_EXPORT
+void SCIPfreeExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_EXPR*            expr                /**< expression */
+   );
+
 /** compare expressions
  * @return -1, 0 or 1 if expr1 <, =, > expr2, respectively
  * @note The given expressions are assumed to be simplified.
@@ -961,7 +1009,7 @@ SCIP_EXPORT
 SCIP_DECL_EXPRGETSYMDATA(SCIPcallExprGetSymData);
 
 #ifdef NDEBUG
-#define SCIPappendExprChild(scip, expr, child)               SCIPexprAppendChild((scip)->set, (scip)->mem->probmem, expr, child)
+#define SCIPappendExprChild(scip, expr, child)               SCIPexprAppendChild((scip)->set, (scip)->stat, (scip)->mem->probmem, expr, child)
 #define SCIPreplaceExprChild(scip, expr, childidx, newchild) SCIPexprReplaceChild((scip)->set, (scip)->stat, (scip)->mem->probmem, expr, childidx, newchild)
 #define SCIPremoveExprChildren(scip, expr)                   SCIPexprRemoveChildren((scip)->set, (scip)->stat, (scip)->mem->probmem, expr)
 #define SCIPduplicateExpr(scip, expr, copyexpr, mapexpr, mapexprdata, ownercreate, ownercreatedata) SCIPexprCopy((scip)->set, (scip)->stat, (scip)->mem->probmem, (scip)->set, (scip)->stat, (scip)->mem->probmem, expr, copyexpr, mapexpr, mapexprdata, ownercreate, ownercreatedata)
@@ -975,10 +1023,13 @@ SCIP_DECL_EXPRGETSYMDATA(SCIPcallExprGetSymData);
 #define SCIPisExprPower(scip, expr)                          SCIPexprIsPower((scip)->set, expr)
 #define SCIPprintExpr(scip, expr, file)                      SCIPexprPrint((scip)->set, (scip)->stat, (scip)->mem->probmem, (scip)->messagehdlr, file, expr)
 #define SCIPevalExpr(scip, expr, sol, soltag)                SCIPexprEval((scip)->set, (scip)->stat, (scip)->mem->probmem, expr, sol, soltag)
+#define SCIPevalExprBatch(scip, expr, npoints, varidxs, varvals, vals) SCIPexprEvalBatch((scip)->set, (scip)->stat, (scip)->mem->probmem, (scip)->mem->buffer, expr, npoints, varidxs, varvals, vals)
 #define SCIPgetExprNewSoltag(scip)                           (++((scip)->stat->exprlastsoltag))
 #define SCIPevalExprGradient(scip, expr, sol, soltag)        SCIPexprEvalGradient((scip)->set, (scip)->stat, (scip)->mem->probmem, expr, sol, soltag)
 #define SCIPevalExprHessianDir(scip, expr, sol, soltag, direction) SCIPexprEvalHessianDir((scip)->set, (scip)->stat, (scip)->mem->probmem, expr, sol, soltag, direction)
 #define SCIPevalExprActivity(scip, expr)                     SCIPexprEvalActivity((scip)->set, (scip)->stat, (scip)->mem->probmem, expr)
+#define SCIPcompileExpr(scip, expr)                          SCIPexprCompile((scip)->set, (scip)->stat, (scip)->mem->probmem, expr)
+#define SCIPfreeExprTape(scip, expr)                         SCIPexprFreeTape((scip)->mem->probmem, expr)
 #define SCIPcompareExpr(scip, expr1, expr2)                  SCIPexprCompare((scip)->set, expr1, expr2)
 #define SCIPsimplifyExpr(scip, rootexpr, simplified, changed, infeasible, ownercreate, ownercreatedata) SCIPexprSimplify((scip)->set, (scip)->stat, (scip)->mem->probmem, rootexpr, simplified, changed, infeasible, ownercreate, ownercreatedata)
 #define SCIPcallExprCurvature(scip, expr, exprcurvature, success, childcurv) SCIPexprhdlrCurvatureExpr(SCIPexprGetHdlr(expr), (scip)->set, expr, exprcurvature, success, childcurv)
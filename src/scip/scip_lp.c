@@ -736,6 +736,57 @@ SCIP_RETCODE SCIPgetLPBInvRow(
    return SCIP_OKAY;
 }
 
+/** gets several rows from the inverse basis matrix B^-1 at once; the k-th requested row is stored in
+ *  coefs[k * nrows, ..., (k+1) * nrows - 1], where nrows is the number of LP rows
+ *
+ *  This is equivalent to calling SCIPgetLPBInvRow() for each row, but leaves it to the LP interface to compute the rows
+ *  together if the LP solver supports this.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_RETCODE SCIPgetLPBInvRows(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nrs,                /**< number of rows to get */
+   const int*            rs,                 /**< row numbers */
+   SCIP_Real*            coefs,              /**< array of size nrs * nrows to store the coefficients of the rows */
+   int*                  inds,               /**< array of size nrs * nrows to store the non-zero indices, or NULL */
+   int*                  ninds               /**< array of size nrs to store the numbers of non-zero indices, or NULL
+                                              *  (-1: if we do not store sparsity informations) */
+   )
+{
+#ifdef SCIP_DEBUG_LP_INTERFACE
+   int nrows;
+   int k;
+#endif
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPgetLPBInvRows", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   if( !SCIPlpIsSolBasic(scip->lp) )
+   {
+      SCIPerrorMessage("current LP solution is not basic\n");
+      return SCIP_INVALIDCALL;
+   }
+
+   SCIP_CALL( SCIPlpGetBInvRows(scip->lp, nrs, rs, coefs, inds, ninds) );
+
+#ifdef SCIP_DEBUG_LP_INTERFACE
+   /* debug check if the coefs are the corresponding lines of the inverse matrix B^-1 */
+   nrows = SCIPlpGetNRows(scip->lp);
+   for( k = 0; k < nrs; ++k )
+   {
+      SCIP_CALL( SCIPdebugCheckBInvRow(scip, rs[k], &coefs[(size_t)k * nrows]) ); /*lint !e506 !e774*/
+   }
+#endif
+
+   return SCIP_OKAY;
+}
+
 /** gets a column from the inverse basis matrix B^-1
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
@@ -2575,6 +2626,45 @@ SCIP_RETCODE SCIPchgRowRhsDive(
    return SCIP_OKAY;
 }
 
+/** installs an LP state (like basis information) in the LP solver of the current dive; can be used to warm start
+ *  the next call of SCIPsolveDiveLP() from a basis that was stored by SCIPlpiGetState() in an earlier dive
+ *
+ *  @note the state is not freed by this method and must match the current dimension of the LP, i.e., it must have been
+ *        stored when the LP contained the same columns and rows in the same order
+ *
+ *  @note the state is only installed if the current diving LP is not solved; it is undone by SCIPendDive()
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_RETCODE SCIPsetDiveLPState(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_LPISTATE*        lpistate            /**< LP state information (like basis information) */
+   )
+{
+   assert(scip != NULL);
+   assert(lpistate != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPsetDiveLPState", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   if( !SCIPlpDiving(scip->lp) )
+   {
+      SCIPerrorMessage("not in diving mode\n");
+      return SCIP_INVALIDCALL;
+   }
+
+   /* the stored basis need not be primal or dual feasible for the current bounds and objective */
+   SCIP_CALL( SCIPlpSetState(scip->lp, scip->mem->probmem, scip->set, scip->transprob, scip->eventqueue, lpistate,
+         FALSE, FALSE, FALSE, FALSE) );
+
+   return SCIP_OKAY;
+}
+
 /** gets variable's objective value in current dive
  *
  *  @return the variable's objective value in current dive.
@@ -529,6 +529,31 @@ SCIP_RETCODE SCIPgetLPBInvRow(
                                               *  (-1: if we do not store sparsity informations) */
    );
 
+/** gets several rows from the inverse basis matrix B^-1 at once; the k-th requested row is stored in
+ *  coefs[k * nrows, ..., (k+1) * nrows - 1], where nrows is the number of LP rows
+ *
+ *  This is equivalent to calling SCIPgetLPBInvRow() for each row, but leaves it to the LP interface to compute the rows
+ *  together if the LP solver supports this.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgetLPBInvRows(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nrs,                /**< number of rows to get */
+   const int*            rs,                 /**< row numbers */
+   SCIP_Real*            coefs,              /**< array of size nrs * nrows to store the coefficients of the rows */
+   int*                  inds,               /**< array of size nrs * nrows to store the non-zero indices, or NULL */
+   int*                  ninds               /**< array of size nrs to store the numbers of non-zero indices, or NULL
+                                              *  (-1: if we do not store sparsity informations) */
+   );
+
 /** gets a column from the inverse basis matrix B^-1
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
@@ -1676,6 +1701,28 @@ SCIP_RETCODE SCIPchgRowRhsDive(
    SCIP_Real             newrhs              /**< new value for rhs */
    );
 
+/** installs an LP state (like basis information) in the LP solver of the current dive; can be used to warm start
+ *  the next call of SCIPsolveDiveLP() from a basis that was stored by SCIPlpiGetState() in an earlier dive
+ *
+ *  @note the state is not freed by this method and must match the current dimension of the LP, i.e., it must have been
+ *        stored when the LP contained the same columns and rows in the same order
+ *
+ *  @note the state is only installed if the current diving LP is not solved; it is undone by SCIPendDive()
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsetDiveLPState(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_LPISTATE*        lpistate            /**< LP state information (like basis information) */
+   );
+
 /** gets variable's objective value in current dive
  *
  *  @return the variable's objective value in current dive.
@@ -101,6 +101,7 @@
 #include "scip/expr_var.h"
 #include "scip/heur_actconsdiving.h"
 #include "scip/heur_adaptivediving.h"
+#include "scip/heur_async.h"
 #include "scip/heur_bound.h"
 #include "scip/heur_clique.h"
 #include "scip/heur_coefdiving.h"
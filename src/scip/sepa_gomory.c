@@ -114,6 +114,8 @@
 #define MAKECONTINTEGRAL          FALSE /**< convert continuous variable to integral variables in SCIPmakeRowIntegral() */
 
 #define MAXAGGRLEN(nvars)          (0.1*(nvars)+1000) /**< maximal length of base inequality */
+#define BINVROWBATCHSIZE             16 /**< maximal number of rows of B^-1 that are fetched from the LP solver at once */
+#define BINVROWBATCHMAXSIZE      (1 << 20) /**< maximal total number of entries of a batch of rows of B^-1 */
 
 
 /** separator data */
@@ -409,13 +411,15 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpGomory)
    SCIP_ROW** rows;
    SCIP_AGGRROW* aggrrow;
    SCIP_VAR* var;
-   SCIP_Real* binvrow;
+   SCIP_Real* binvrows;
    SCIP_Real* cutcoefs;
    SCIP_Real* basisfrac;
    SCIP_Real* cutefficacies;
    int* basisind;
    int* basisperm;
    int* inds;
+   int* ninds;
+   int* batchrows;
    int* cutinds;
    int* colindsproducedcut;
    SCIP_Real maxscale;
@@ -433,10 +437,14 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpGomory)
    int ncalls;
    int maxdepth;
    int maxsepacuts;
+   int batchsize;
+   int nbatchrows;
+   int batchpos;
    int freq;
    int c;
    int i;
    int j;
+   int k;
 
    assert(sepa != NULL);
    assert(strcmp(SCIPsepaGetName(sepa), SEPA_NAME) == 0);
@@ -526,14 +534,30 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpGomory)
       maxscale = 10.0;
    }
 
+   /* get the maximal number of cuts allowed in a separation round */
+   if( depth == 0 )
+      maxsepacuts = sepadata->maxsepacutsroot;
+   else
+      maxsepacuts = sepadata->maxsepacuts;
+
+   /* rows of B^-1 are fetched in batches; since every tableau row yields at most two cuts, there is no need to
+    * fetch more rows at once than cuts are allowed; the rows are stored densely, so the batch is also limited in size
+    * to keep the memory consumption on large LPs at the level of fetching single rows
+    */
+   batchsize = MIN3(BINVROWBATCHSIZE, nrows, maxsepacuts);
+   batchsize = MIN(batchsize, BINVROWBATCHMAXSIZE / MAX(nrows, 1));
+   batchsize = MAX(batchsize, 1);
+
    /* allocate temporary memory */
    SCIP_CALL( SCIPallocBufferArray(scip, &cutcoefs, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &cutinds, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &basisind, nrows) );
    SCIP_CALL( SCIPallocBufferArray(scip, &basisperm, nrows) );
    SCIP_CALL( SCIPallocBufferArray(scip, &basisfrac, nrows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &binvrow, nrows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &inds, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &binvrows, (size_t)batchsize * nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &inds, (size_t)batchsize * nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ninds, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchrows, batchsize) );
    SCIP_CALL( SCIPallocBufferArray(scip, &cutefficacies, nrows) );
    SCIP_CALL( SCIPallocBufferArray(scip, &colindsproducedcut, nrows) );
    SCIP_CALL( SCIPaggrRowCreate(scip, &aggrrow) );
@@ -589,17 +613,13 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpGomory)
    /* sort basis indices by fractionality */
    SCIPsortDownRealInt(basisfrac, basisperm, nrows);
 
-   /* get the maximal number of cuts allowed in a separation round */
-   if( depth == 0 )
-      maxsepacuts = sepadata->maxsepacutsroot;
-   else
-      maxsepacuts = sepadata->maxsepacuts;
-
    SCIPdebugMsg(scip, "searching gomory cuts: %d cols, %d rows, maxdnom=%" SCIP_LONGINT_FORMAT ", maxscale=%g, maxcuts=%d\n",
       ncols, nrows, maxdnom, maxscale, maxsepacuts);
 
    cutoff = FALSE;
    naddedcuts = 0;
+   nbatchrows = 0;
+   batchpos = 0;
 
    /* for all basic columns belonging to integer variables, try to generate a gomory cut */
    for( i = 0; i < nrows && naddedcuts < maxsepacuts && !SCIPisStopped(scip) && !cutoff; ++i )
@@ -609,7 +629,6 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpGomory)
       SCIP_Bool success;
       SCIP_Bool cutislocal;
       SCIP_Bool strongcgsuccess = FALSE;
-      int ninds = -1;
       int cutnnz;
       int cutrank;
 
@@ -619,11 +638,30 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpGomory)
       j = basisperm[i];
       c = basisind[j];
 
-      /* get the row of B^-1 for this basic integer variable with fractional solution value */
-      SCIP_CALL( SCIPgetLPBInvRow(scip, j, binvrow, inds, &ninds) );
+      /* get the rows of B^-1 for the next basic integer variables with fractional solution value, if the rows of the
+       * previous batch have all been processed
+       */
+      if( batchpos == nbatchrows )
+      {
+         int nbatchmax;
+
+         nbatchmax = MIN(batchsize, maxsepacuts - naddedcuts);
+         for( k = i, nbatchrows = 0; k < nrows && nbatchrows < nbatchmax && basisfrac[k] != 0.0; ++k, ++nbatchrows )
+         {
+            batchrows[nbatchrows] = basisperm[k];
+            ninds[nbatchrows] = -1;
+         }
+         assert(nbatchrows >= 1);
+
+         SCIP_CALL( SCIPgetLPBInvRows(scip, nbatchrows, batchrows, binvrows, inds, ninds) );
+         batchpos = 0;
+      }
+      assert(batchpos < nbatchrows);
+      assert(batchrows[batchpos] == j);
 
-      SCIP_CALL( SCIPaggrRowSumRows(scip, aggrrow, binvrow, inds, ninds,
-         sepadata->sidetypebasis, allowlocal, 2, (int) MAXAGGRLEN(nvars), &success) );
+      SCIP_CALL( SCIPaggrRowSumRows(scip, aggrrow, &binvrows[(size_t)batchpos * nrows], &inds[(size_t)batchpos * nrows],
+         ninds[batchpos], sepadata->sidetypebasis, allowlocal, 2, (int) MAXAGGRLEN(nvars), &success) );
+      ++batchpos;
 
       if( !success )
          continue;
@@ -706,8 +744,10 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpGomory)
    SCIPaggrRowFree(scip, &aggrrow);
    SCIPfreeBufferArray(scip, &colindsproducedcut);
    SCIPfreeBufferArray(scip, &cutefficacies);
+   SCIPfreeBufferArray(scip, &batchrows);
+   SCIPfreeBufferArray(scip, &ninds);
    SCIPfreeBufferArray(scip, &inds);
-   SCIPfreeBufferArray(scip, &binvrow);
+   SCIPfreeBufferArray(scip, &binvrows);
    SCIPfreeBufferArray(scip, &basisfrac);
    SCIPfreeBufferArray(scip, &basisperm);
    SCIPfreeBufferArray(scip, &basisind);
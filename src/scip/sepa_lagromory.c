@@ -232,6 +232,8 @@
 #define USEVBDS                                       TRUE /**< use variable bounds? - see SCIPcalcMIR() */
 #define FIXINTEGRALRHS                               FALSE /**< try to generate an integral rhs? - see SCIPcalcMIR() */
 #define MAXAGGRLEN(ncols)               (0.1*(ncols)+1000) /**< maximal length of base inequality */
+#define BINVROWBATCHSIZE                  16 /**< maximal number of rows of B^-1 that are fetched from the LP solver at once */
+#define BINVROWBATCHMAXSIZE           (1 << 20) /**< maximal total number of entries of a batch of rows of B^-1 */
 
 /*
  * Data structures
@@ -2016,7 +2018,7 @@ SCIP_RETCODE generateGMICuts(
    SCIP_Real maxfrac;
    SCIP_Real frac;
    SCIP_Real* basisfrac;
-   SCIP_Real* binvrow;
+   SCIP_Real* binvrows;
    SCIP_AGGRROW* aggrrow;
    SCIP_Bool success;
    SCIP_Real* cutcoefs;
@@ -2032,13 +2034,16 @@ SCIP_RETCODE generateGMICuts(
    int* cutinds;
    int* basisind;
    int* inds;
+   int* ninds;
+   int* batchrows;
    int nrows;
    int ncols;
    int* basisperm;
-   int k;
    int c;
-   int ninds;
    int nmaxcutsperlp;
+   int batchsize;
+   int nbatchrows;
+   int batchpos;
    int i;
 
    assert(ngeneratednewcuts != NULL);
@@ -2050,11 +2055,20 @@ SCIP_RETCODE generateGMICuts(
    *ngeneratednewcuts = 0;
    nmaxcutsperlp = ((depth == 0) ? sepadata->nmaxcutsperlproot : sepadata->nmaxcutsperlp);
 
+   /* rows of B^-1 are fetched in batches, but not more rows than cuts are allowed in this call; the rows are stored
+    * densely, so the batch is also limited in size to keep the memory consumption on large LPs in check
+    */
+   batchsize = MIN3(BINVROWBATCHSIZE, nrows, nmaxcutsperlp);
+   batchsize = MIN(batchsize, BINVROWBATCHMAXSIZE / MAX(nrows, 1));
+   batchsize = MAX(batchsize, 1);
+
    /* allocate memory */
    SCIP_CALL( SCIPallocBufferArray(scip, &basisperm, nrows) );
    SCIP_CALL( SCIPallocBufferArray(scip, &basisfrac, nrows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &binvrow, nrows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &inds, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &binvrows, (size_t)batchsize * nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &inds, (size_t)batchsize * nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ninds, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchrows, batchsize) );
    SCIP_CALL( SCIPallocBufferArray(scip, &basisind, nrows) );
    SCIP_CALL( SCIPallocBufferArray(scip, &cutcoefs, ncols) );
    SCIP_CALL( SCIPallocBufferArray(scip, &cutinds, ncols) );
@@ -2117,6 +2131,9 @@ SCIP_RETCODE generateGMICuts(
       SCIPsortDownRealInt(basisfrac, basisperm, nrows);
    }
 
+   nbatchrows = 0;
+   batchpos = 0;
+
    /* for all basic columns belonging to integer variables, try to generate a GMI cut */
    for( i = 0; i < nrows && !SCIPisStopped(scip) && !*cutoff; ++i )
    {
@@ -2125,7 +2142,6 @@ SCIP_RETCODE generateGMICuts(
           (*ngeneratednewcuts >= nmaxcutsperlp) )
          break;
 
-      ninds = -1;
       cutefficacy = 0.0;
 
       /* either break the loop or proceed to the next iteration if the fractionality is zero */
@@ -2137,13 +2153,46 @@ SCIP_RETCODE generateGMICuts(
             continue;
       }
 
-      k = basisperm[i];
+      /* get the rows of B^-1 for the next basic integer variables with fractional solution value, if the rows of the
+       * previous batch have all been processed
+       */
+      if( batchpos == nbatchrows )
+      {
+         int nbatchmax;
+         int l;
+
+         nbatchmax = MIN3(nmaxgeneratedperroundcuts - ngeneratedcurrroundcuts,
+               sepadata->nmaxtotalcuts - sepadata->ntotalcuts, nmaxcutsperlp) - *ngeneratednewcuts;
+         nbatchmax = MIN(nbatchmax, batchsize);
+         assert(nbatchmax >= 1);
+
+         nbatchrows = 0;
+         for( l = i; l < nrows && nbatchrows < nbatchmax; ++l )
+         {
+            if( basisfrac[l] == 0.0 )
+            {
+               if( sepadata->sortcutoffsol )
+                  break;
+               else
+                  continue;
+            }
 
-      /* get the row of B^-1 for this basic integer variable with fractional solution value and call aggregate function */
-      SCIP_CALL( SCIPgetLPBInvRow(scip, k, binvrow, inds, &ninds) );
+            batchrows[nbatchrows] = basisperm[l];
+            ninds[nbatchrows] = -1;
+            ++nbatchrows;
+         }
+         assert(nbatchrows >= 1);
+
+         SCIP_CALL( SCIPgetLPBInvRows(scip, nbatchrows, batchrows, binvrows, inds, ninds) );
+         batchpos = 0;
+      }
+      assert(batchpos < nbatchrows);
+      assert(batchrows[batchpos] == basisperm[i]);
 
-      SCIP_CALL( SCIPaggrRowSumRows(scip, aggrrow, binvrow, inds, ninds, sepadata->sidetypebasis, allowlocal, 2,
-            (int) MAXAGGRLEN(ncols), &success) );
+      /* aggregate the row of B^-1 for this basic integer variable with fractional solution value */
+      SCIP_CALL( SCIPaggrRowSumRows(scip, aggrrow, &binvrows[(size_t)batchpos * nrows], &inds[(size_t)batchpos * nrows],
+            ninds[batchpos], sepadata->sidetypebasis, allowlocal, 2, (int) MAXAGGRLEN(ncols), &success) );
+      ++batchpos;
 
       if( !success )
          continue;
@@ -2172,8 +2221,10 @@ SCIP_RETCODE generateGMICuts(
    SCIPfreeBufferArray(scip, &cutinds);
    SCIPfreeBufferArray(scip, &cutcoefs);
    SCIPfreeBufferArray(scip, &basisind);
+   SCIPfreeBufferArray(scip, &batchrows);
+   SCIPfreeBufferArray(scip, &ninds);
    SCIPfreeBufferArray(scip, &inds);
-   SCIPfreeBufferArray(scip, &binvrow);
+   SCIPfreeBufferArray(scip, &binvrows);
    SCIPfreeBufferArray(scip, &basisfrac);
    SCIPfreeBufferArray(scip, &basisperm);
    SCIPaggrRowFree(scip, &aggrrow);
@@ -166,6 +166,8 @@
 /* Conflict Analysis (dual ray) */
 
 #define SCIP_DEFAULT_CONF_SEPAALTPROOFS   FALSE /**< apply cut generating functions to construct alternative proofs */
+#define SCIP_DEFAULT_CONF_MAXALTPROOFS        1 /**< maximal number of alternative proofs constructed from a dual proof */
+#define SCIP_DEFAULT_CONF_ALTPROOFTHREADS     1 /**< maximal number of threads used to construct alternative proofs */
 #define SCIP_DEFAULT_CONF_USELOCALROWS    TRUE  /**< use local rows to construct infeasibility proofs */
 
 /* Constraints */
@@ -295,6 +297,8 @@
                                                  *   to FALSE and therefore can be used to collect statistics over all
                                                  *   runs) */
 #define SCIP_DEFAULT_MISC_IMPROVINGSOLS   FALSE /**< should only solutions be checked which improve the primal bound */
+#define SCIP_DEFAULT_MISC_DIVERSESOLS     FALSE /**< should solutions with the same integral assignment as a better solution be
+                                                 *   removed first if the solution storage is full? */
 #define SCIP_DEFAULT_MISC_PRINTREASON      TRUE /**< should the reason be printed if a given start solution is infeasible? */
 #define SCIP_DEFAULT_MISC_ESTIMEXTERNMEM   TRUE /**< should the usage of external memory be estimated? */
 #define SCIP_DEFAULT_MISC_AVOIDMEMOUT      TRUE /**< try to avoid running into memory limit by restricting plugins like heuristics? */
@@ -1543,6 +1547,16 @@ SCIP_RETCODE SCIPsetCreate(
          "apply cut generating functions to construct alternative proofs",
          &(*set)->conf_sepaaltproofs, FALSE, SCIP_DEFAULT_CONF_SEPAALTPROOFS,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "conflict/maxaltproofs",
+         "maximal number of alternative proofs that are constructed from a dual proof if conflict/sepaaltproofs is enabled",
+         &(*set)->conf_maxaltproofs, TRUE, SCIP_DEFAULT_CONF_MAXALTPROOFS, 1, INT_MAX,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "conflict/altproofthreads",
+         "maximal number of threads used to construct alternative proofs by scaled mixed-integer rounding",
+         &(*set)->conf_altproofthreads, TRUE, SCIP_DEFAULT_CONF_ALTPROOFTHREADS, 1, 64,
+         NULL, NULL) );
 
    /* constraint parameters */
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
@@ -1985,6 +1999,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should only solutions be checked which improve the primal bound",
          &(*set)->misc_improvingsols, FALSE, SCIP_DEFAULT_MISC_IMPROVINGSOLS,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "misc/diversesols",
+         "should solutions with the same integral assignment as a better solution be removed first if the solution storage is full?",
+         &(*set)->misc_diversesols, FALSE, SCIP_DEFAULT_MISC_DIVERSESOLS,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
          "misc/printreason",
          "should the reason be printed if a given start solution is infeasible",
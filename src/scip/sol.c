@@ -308,6 +308,7 @@ SCIP_RETCODE SCIPsolCreate(
    (*sol)->primalindex = -1;
    (*sol)->index = stat->solindex;
    (*sol)->hasinfval = FALSE;
+   (*sol)->hasassignhash = FALSE;
    SCIPsolResetViolations(*sol);
    stat->solindex++;
    solStamp(*sol, stat, tree, TRUE);
@@ -345,6 +346,7 @@ SCIP_RETCODE SCIPsolCreateOriginal(
    (*sol)->primalindex = -1;
    (*sol)->index = stat->solindex;
    (*sol)->hasinfval = FALSE;
+   (*sol)->hasassignhash = FALSE;
    stat->solindex++;
    solStamp(*sol, stat, tree, TRUE);
 
@@ -406,6 +408,7 @@ SCIP_RETCODE SCIPsolCopy(
    (*sol)->depth = sourcesol->depth;
    (*sol)->index = stat->solindex;
    (*sol)->hasinfval = sourcesol->hasinfval;
+   (*sol)->hasassignhash = FALSE;
    stat->solindex++;
    (*sol)->viol.absviolbounds = sourcesol->viol.absviolbounds;
    (*sol)->viol.absviolcons = sourcesol->viol.absviolcons;
@@ -750,6 +753,7 @@ SCIP_RETCODE SCIPsolCreatePartial(
    (*sol)->primalindex = -1;
    (*sol)->index = stat->solindex;
    (*sol)->hasinfval = FALSE;
+   (*sol)->hasassignhash = FALSE;
    stat->solindex++;
    solStamp(*sol, stat, NULL, TRUE);
    SCIPsolResetViolations(*sol);
@@ -785,6 +789,7 @@ SCIP_RETCODE SCIPsolCreateUnknown(
    (*sol)->primalindex = -1;
    (*sol)->index = stat->solindex;
    (*sol)->hasinfval = FALSE;
+   (*sol)->hasassignhash = FALSE;
    stat->solindex++;
    solStamp(*sol, stat, tree, TRUE);
    SCIPsolResetViolations(*sol);
@@ -2282,6 +2287,45 @@ SCIP_Bool SCIPsolsAreEqual(
    return TRUE;
 }
 
+/** returns a hash value of the values that the solution assigns to the integral variables of the original problem
+ *
+ *  Solutions that are equal in the sense of SCIPsolsAreEqual() have the same hash value, unless values lie on the
+ *  boundary of the integrality tolerance; thus, different hash values can be used to skip the full comparison.
+ */
+uint32_t SCIPsolGetIntAssignmentHash(
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_PROB*            origprob            /**< original problem */
+   )
+{
+   uint32_t hash;
+   int v;
+
+   assert(sol != NULL);
+   assert(origprob != NULL);
+
+   hash = (uint32_t) origprob->nvars;
+
+   /* combine the values of the integral variables in the order of the original problem */
+   for( v = 0; v < origprob->nvars; ++v )
+   {
+      SCIP_Real val;
+
+      if( SCIPvarGetType(origprob->vars[v]) == SCIP_VARTYPE_CONTINUOUS )
+         continue;
+
+      val = SCIPsolGetVal(sol, set, stat, origprob->vars[v]);
+
+      /* all fractional values are mapped to the same key, such that the hash only depends on the integral values */
+      val = SCIPsetIsIntegral(set, val) ? SCIPsetRound(set, val) : 0.5;
+
+      hash = SCIPhashTwo(hash, SCIPrealHashCode(val));
+   }
+
+   return hash;
+}
+
 /** outputs non-zero elements of solution to file stream */
 SCIP_RETCODE SCIPsolPrint(
    SCIP_SOL*             sol,                /**< primal CIP solution */
@@ -425,6 +425,18 @@ SCIP_Bool SCIPsolsAreEqual(
    SCIP_PROB*            transprob           /**< transformed problem after presolve */
    );
 
+/** returns a hash value of the values that the solution assigns to the integral variables of the original problem
+ *
+ *  Solutions that are equal in the sense of SCIPsolsAreEqual() have the same hash value, unless values lie on the
+ *  boundary of the integrality tolerance; thus, different hash values can be used to skip the full comparison.
+ */
+uint32_t SCIPsolGetIntAssignmentHash(
+   SCIP_SOL*             sol,                /**< primal CIP solution */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_PROB*            origprob            /**< original problem */
+   );
+
 /** outputs non-zero elements of solution to file stream */
 SCIP_RETCODE SCIPsolPrint(
    SCIP_SOL*             sol,                /**< primal CIP solution */
@@ -104,6 +104,7 @@ SCIP_RETCODE SCIPstatCreate(
    (*stat)->subscipdepth = 0;
    (*stat)->detertimecnt = 0.0;
    (*stat)->nreoptruns = 0;
+   (*stat)->exprlaststructtag = 0;
 
    SCIPstatReset(*stat, set, transprob, origprob);
 
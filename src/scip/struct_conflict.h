@@ -83,9 +83,23 @@ struct SCIP_ConflictSet
    unsigned int          sorted:1;           /**< is the conflict set sorted */
    unsigned int          usescutoffbound:1;  /**< is the conflict based on the cutoff bound? */
    unsigned int          hasrelaxonlyvar:1;  /**< is one of the bound change informations using a relaxation-only variable */
+   unsigned int          arraysinarena:1;    /**< are the arrays allocated in the conflict set arena of the conflict analysis? */
    SCIP_CONFTYPE         conflicttype;       /**< conflict type: unknown, infeasible LP, bound exceeding LP, propagation */
 };
 
+/** priority queue of bound changes, where the latest bound change comes first
+ *
+ *  The depth and position of each bound change are stored as a key next to it, such that the heap operations do not
+ *  need to access the bound change informations.
+ */
+struct SCIP_BdchgQueue
+{
+   SCIP_BDCHGINFO**      bdchginfos;         /**< bound change informations in heap order */
+   SCIP_Longint*         keys;               /**< depth and position of the bound changes in heap order */
+   int                   len;                /**< number of bound changes in the queue */
+   int                   size;               /**< size of the bdchginfos and keys arrays */
+};
+
 /** set of conflicting bound changes */
 struct SCIP_ProofSet
 {
@@ -175,14 +189,20 @@ struct SCIP_Conflict
    SCIP_CLOCK*           boundlpanalyzetime; /**< time used for bound exceeding LP conflict analysis */
    SCIP_CLOCK*           sbanalyzetime;      /**< time used for strong branching LP conflict analysis */
    SCIP_CLOCK*           pseudoanalyzetime;  /**< time used for pseudo solution conflict analysis */
-   SCIP_PQUEUE*          bdchgqueue;         /**< unprocessed conflict bound changes */
-   SCIP_PQUEUE*          forcedbdchgqueue;   /**< unprocessed conflict bound changes that must be resolved */
+   SCIP_BDCHGQUEUE*      bdchgqueue;         /**< unprocessed conflict bound changes */
+   SCIP_BDCHGQUEUE*      forcedbdchgqueue;   /**< unprocessed conflict bound changes that must be resolved */
    SCIP_PROOFSET*        proofset;           /**< proof sets found at the current node */
    SCIP_PROOFSET**       proofsets;          /**< proof sets found at the current node */
    SCIP_CONFLICTSET*     conflictset;        /**< bound changes resembling the current conflict set */
    SCIP_CONFLICTSET**    conflictsets;       /**< conflict sets found at the current node */
    SCIP_Real*            conflictsetscores;  /**< score values of the conflict sets found at the current node */
    SCIP_BDCHGINFO**      tmpbdchginfos;      /**< temporarily created bound change information data */
+   char**                arenachunks;        /**< memory chunks of the arena for the arrays of the conflict sets found
+                                              *   at the current node, which is reset when the conflict sets are flushed */
+   size_t*               arenachunksizes;    /**< sizes of the arena chunks in bytes */
+   size_t                arenaused;          /**< number of used bytes in the last arena chunk */
+   int                   narenachunks;       /**< number of arena chunks */
+   int                   arenachunksarraysize; /**< size of arenachunks and arenachunksizes arrays */
    int                   conflictsetssize;   /**< size of conflictsets array */
    int                   nconflictsets;      /**< number of available conflict sets (used slots in conflictsets array) */
    int                   proofsetssize;      /**< size of proofsets array */
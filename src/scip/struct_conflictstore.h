@@ -51,6 +51,10 @@ struct SCIP_ConflictStore
    SCIP_CONS**           origconfs;          /**< array of original conflicts added in stage SCIP_STAGE_PROBLEM */
    SCIP_Real*            confprimalbnds;     /**< array of primal bounds valid at the time the corresponding bound exceeding
                                               *   conflict was found (-infinity if the conflict based on an infeasible LP) */
+   uint64_t*             confsignatures;     /**< array of bit signatures of the variables of the conflicts (0 if the
+                                              *   conflict is not checked for subsumption) */
+   int*                  conflbds;           /**< array of literal block distances of the conflicts, i.e., the number of
+                                              *   distinct depths at which their literals became false (-1 if unknown) */
    SCIP_Real*            dualprimalbnds;     /**< array of primal bounds valid at the time the corresponding dual proof
                                               *   based on a dual solution was found */
    SCIP_Real*            scalefactors;       /**< scaling factor that needs to be considered when updating the side */
@@ -63,6 +67,7 @@ struct SCIP_ConflictStore
    SCIP_Longint          ncleanups;          /**< number of storage cleanups */
    SCIP_Longint          nnzdualrays;        /**< number of non-zeros in all stored proofs based on dual rays */
    SCIP_Longint          nnzdualsols;        /**< number of non-zeros in all stored proofs based on dual solutions */
+   SCIP_Longint          nsubsumed;          /**< number of conflicts removed because another conflict subsumes them */
    int                   conflictsize;       /**< size of conflict array (bounded by conflict->maxpoolsize) */
    int                   origconflictsize;   /**< size of origconfs array */
    int                   nconflicts;         /**< number of stored conflicts */
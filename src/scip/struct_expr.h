@@ -57,6 +57,7 @@ struct SCIP_Exprhdlr
    SCIP_DECL_EXPRPRINT((*print));            /**< print callback (can be NULL) */
    SCIP_DECL_EXPRPARSE((*parse));            /**< parse callback (can be NULL) */
    SCIP_DECL_EXPREVAL((*eval));              /**< point evaluation callback (can never be NULL) */
+   SCIP_DECL_EXPREVALBATCH((*evalbatch));    /**< batched point evaluation callback (can be NULL) */
    SCIP_DECL_EXPRBWDIFF((*bwdiff));          /**< backward derivative evaluation callback (can be NULL) */
    SCIP_DECL_EXPRFWDIFF((*fwdiff));          /**< forward derivative evaluation callback (can be NULL) */
    SCIP_DECL_EXPRBWFWDIFF((*bwfwdiff));      /**< backward over forward derivative evaluation callback (can be NULL) */
@@ -143,6 +144,46 @@ struct SCIP_Expr
    /* view expression as quadratic */
    SCIP_QUADEXPR*        quaddata;            /**< representation of expression as a quadratic, if checked and being quadratic */
    SCIP_Bool             quadchecked;         /**< whether it has been checked whether the expression is quadratic */
+
+   /* compiled evaluation */
+   SCIP_EXPRTAPE*        tape;                /**< evaluation tape of expression and its descendants, or NULL if not compiled */
+};
+
+/** operation types of an expression tape
+ *
+ * Operations of the most common expression handlers are evaluated and differentiated directly on the tape,
+ * all others by calling the callbacks of their expression handler.
+ */
+enum SCIP_ExprTapeOp
+{
+   SCIP_EXPRTAPEOP_VAR     = 0,              /**< variable */
+   SCIP_EXPRTAPEOP_VALUE   = 1,              /**< constant value */
+   SCIP_EXPRTAPEOP_SUM     = 2,              /**< sum */
+   SCIP_EXPRTAPEOP_PRODUCT = 3,              /**< product */
+   SCIP_EXPRTAPEOP_EXP     = 4,              /**< exponential */
+   SCIP_EXPRTAPEOP_LOG     = 5,              /**< natural logarithm */
+   SCIP_EXPRTAPEOP_OTHER   = 6               /**< any other expression, evaluated by its expression handler */
+};
+typedef enum SCIP_ExprTapeOp SCIP_EXPRTAPEOP;
+
+/** evaluation tape of an expression
+ *
+ * The tape stores the distinct subexpressions of an expression in a topological order (children before parents,
+ * the expression itself last) together with the tape positions of their children, such that evaluation and
+ * differentiation are loops over contiguous arrays instead of walks over the expression graph.
+ * The tape is valid as long as the structure tag in the problem statistics is unchanged, i.e., no children have
+ * been added, replaced, or removed in any expression since it has been compiled.
+ */
+struct SCIP_ExprTape
+{
+   SCIP_EXPR**           exprs;              /**< subexpressions in topological order */
+   SCIP_EXPRTAPEOP*      ops;                /**< operation types of subexpressions */
+   int*                  childbegin;         /**< position of first child of each subexpression in childpos (size nops+1) */
+   int*                  childpos;           /**< tape positions of children of subexpressions */
+   SCIP_Real*            vals;               /**< values of subexpressions in last evaluation */
+   SCIP_Real*            adjoints;           /**< partial derivatives of expression w.r.t. subexpressions */
+   int                   nops;               /**< number of subexpressions on tape */
+   SCIP_Longint          structtag;          /**< structure tag for which the tape was compiled */
 };
 
 /** representation of an expression as quadratic */
@@ -120,6 +120,8 @@ struct SCIP_Heur
    int                   ndivesets;          /**< number of diving controllers of this heuristic */
    SCIP_HEURTIMING       timingmask;         /**< positions in the node solving loop where heuristic should be executed */
    SCIP_Bool             usessubscip;        /**< does the heuristic use a secondary SCIP instance? */
+   SCIP_Bool             async;              /**< can the heuristic be executed asynchronously on a copy of the problem? */
+   SCIP_Bool             delegated;          /**< is the heuristic executed asynchronously instead of at the nodes? */
    SCIP_Bool             initialized;        /**< is primal heuristic initialized? */
    char                  dispchar;           /**< display character of primal heuristic */
 };
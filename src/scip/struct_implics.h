@@ -91,6 +91,7 @@ struct SCIP_CliqueList
    SCIP_CLIQUE**         cliques[2];         /**< cliques the variable fixed to FALSE/TRUE is member of */
    int                   ncliques[2];        /**< number of cliques the variable fixed to FALSE/TRUE is member of */
    int                   size[2];            /**< size of cliques arrays */
+   uint64_t              idmask[2];          /**< bitset of the clique ids modulo 64 for quickly excluding common cliques */
 };
 
 /** collection of cliques */
@@ -101,6 +102,7 @@ struct SCIP_CliqueTable
    SCIP_DISJOINTSET*     djset;              /**< disjoint set (union find) data structure to maintain component information */
    SCIP_CLIQUE**         cliques;            /**< cliques stored in the table */
    SCIP_Longint          nentries;           /**< number of entries in the whole clique table */
+   SCIP_Longint          ncompdelentries;    /**< number of entries removed since the last computation of the components */
    int                   ncliques;           /**< number of cliques stored in the table */
    int                   size;               /**< size of cliques array */
    int                   ncreatedcliques;    /**< number of ever created cliques */
@@ -108,6 +110,7 @@ struct SCIP_CliqueTable
    int                   ncleanupaggrvars;   /**< number of aggregated variables when the last cleanup was performed */
    int                   ndirtycliques;      /**< number of cliques stored when the last cleanup was performed */
    int                   ncliquecomponents;  /**< number of connected components in clique graph */
+   int                   ncompnonbinvars;    /**< number of nonbinary variable nodes in the disjoint set of the components */
    SCIP_Bool             incleanup;          /**< is this clique table currently performing cleanup? */
    SCIP_Bool             compsfromscratch;   /**< must the connected components of the clique graph be recomputed from scratch? */
 };
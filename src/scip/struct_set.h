@@ -275,6 +275,8 @@ struct SCIP_Set
    SCIP_Real             conf_weightrepropdepth;/**< weight of the prepropagtion depth of a conflict used in score calculation */
    SCIP_Real             conf_weightvaliddepth;/**< weight of the valid depth of a conflict used in score calculation */
    SCIP_Bool             conf_sepaaltproofs;      /**< separate valid inequalities from dualray proofs */
+   int                   conf_maxaltproofs;  /**< maximal number of alternative proofs constructed from a dual proof */
+   int                   conf_altproofthreads;/**< maximal number of threads used to construct alternative proofs */
    SCIP_Real             conf_minimprove;    /**< minimal improvement of primal bound to remove conflicts depending on
                                               *   a previous incumbent.
                                               */
@@ -399,6 +401,8 @@ struct SCIP_Set
                                               *   case of bender decomposition this parameter should be set to FALSE and
                                               *   therefore can be used to collect statistics over all runs) */
    SCIP_Bool             misc_improvingsols; /**< should only solutions be checked which improve the primal bound */
+   SCIP_Bool             misc_diversesols;   /**< should solutions with the same integral assignment as a better solution be
+                                              *   removed first if the solution storage is full? */
    SCIP_Bool             misc_printreason;   /**< should the reason be printed if a given start solution is infeasible? */
    SCIP_Bool             misc_estimexternmem;/**< should the usage of external memory be estimated? */
    SCIP_Bool             misc_avoidmemout;   /**< try to avoid running into memory limit by restricting plugins like heuristics? */
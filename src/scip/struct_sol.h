@@ -88,11 +88,15 @@ struct SCIP_Sol
    int                   depth;              /**< depth at which the solution was found */
    int                   primalindex;        /**< index of solution in array of existing solutions of primal data */
    int                   index;              /**< consecutively numbered unique index of all created solutions */
+   uint32_t              assignhash;         /**< hash value of the integral assignment, see SCIPsolGetIntAssignmentHash();
+                                              *   only valid if hasassignhash is TRUE */
    SCIP_SOLORIGIN        solorigin;          /**< origin of solution: where to retrieve uncached elements */
    SCIP_Bool             hasinfval;          /**< does the solution (potentially) contain an infinite value? Note: this
                                               * could also be implemented as a counter for the number of infinite
                                               * values, to avoid redundant checks when resetting inf. solution values
                                               */
+   SCIP_Bool             hasassignhash;      /**< is the hash value of the integral assignment stored? this is only done for
+                                              *   solutions in the solution storage, which do not change anymore */
    SCIP_SOLTYPE          type;               /**< type of solution: heuristic or (LP) relaxation solution, or unspecified origin */
 #ifndef NDEBUG
    SCIP_Longint          lpcount;            /**< number of LPs solved when this solution was created, needed for debug checks
@@ -35,7 +35,20 @@
 #include "scip/misc.h"
 #include "symmetry/struct_symmetry.h"
 #include "symmetry/type_symmetry.h"
+#include "tpi/tpi.h"
 
+/** minimal total number of nodes and edges of a graph such that its colors are computed in parallel */
+#define MINPARALLELSORTSIZE      100000
+
+/** data of a job sorting one kind of nodes or the edges of a symmetry detection graph */
+struct SymSortJob
+{
+   int*                  perm;               /**< permutation to be computed by the sort */
+   SCIP_DECL_SORTINDCOMP((*indcomp));        /**< comparator of the nodes or edges */
+   void*                 dataptr;            /**< data passed to the comparator */
+   int                   len;                /**< number of nodes or edges to be sorted */
+};
+typedef struct SymSortJob SYMSORTJOB;
 
 /** creates and initializes a symmetry detection graph with memory for the given number of nodes and edges
  *
@@ -1325,6 +1338,24 @@ SCIP_Bool isFixedVar(
    return FALSE;
 }
 
+/** sorts one kind of nodes or the edges of a symmetry detection graph
+ *
+ *  The comparators only read the graph, so the jobs of the different kinds can be executed in parallel.
+ */
+static
+SCIP_RETCODE symSortJob(
+   void*                 args                /**< sorting job */
+   )
+{
+   SYMSORTJOB* job = (SYMSORTJOB*) args;
+
+   assert(job != NULL);
+
+   SCIPsort(job->perm, job->indcomp, job->dataptr, job->len);
+
+   return SCIP_OKAY;
+}
+
 /** computes colors of nodes and edges
  *
  * Colors are detected by sorting different types of nodes (variables, operators, values, and constraint) and edges.
@@ -1336,6 +1367,24 @@ SCIP_RETCODE SCIPcomputeSymgraphColors(
    SYM_SPEC              fixedtype           /**< variable types that must be fixed by symmetries */
    )
 {
+   SCIP_CALL( SCIPcomputeSymgraphColorsParallel(scip, graph, fixedtype, 1) );
+
+   return SCIP_OKAY;
+}
+
+/** computes colors of nodes and edges, where the different types of nodes and the edges are sorted in parallel
+ *
+ *  The computed colors are the same as the ones of SCIPcomputeSymgraphColors().
+ */
+SCIP_RETCODE SCIPcomputeSymgraphColorsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SYM_GRAPH*            graph,              /**< symmetry detection graph */
+   SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
+   int                   nthreads            /**< maximal number of threads used for sorting (1: sequential) */
+   )
+{
+   SYMSORTJOB jobs[5];
+   void* jobargs[5];
    SCIP_VAR* prevvar;
    SCIP_VAR* thisvar;
    SCIP_Real prevval;
@@ -1383,26 +1432,53 @@ SCIP_RETCODE SCIPcomputeSymgraphColors(
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &graph->conscolors, graph->nconsnodes) );
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &graph->edgecolors, graph->nedges) );
 
-   /* allocate permutation of arrays, will be initialized by SCIPsort() */
-   len = graph->nedges;
-   if ( graph->nopnodes > len )
-      len = graph->nopnodes;
-   if ( graph->nvalnodes > len )
-      len = graph->nvalnodes;
-   if ( graph->nconsnodes > len )
-      len = graph->nconsnodes;
-   if ( nusedvars > len )
-      len = nusedvars;
-
+   /* allocate permutations of all kinds of nodes and of the edges, will be initialized by SCIPsort() */
+   len = nusedvars + graph->nopnodes + graph->nvalnodes + graph->nconsnodes + graph->nedges;
    SCIP_CALL( SCIPallocBufferArray(scip, &perm, len) );
 
-   /* find colors of variable nodes */
+   /* sort the variable, operator, value, and constraint nodes and the edges, possibly in parallel */
    assert(graph->nsymvars > 0);
+   jobs[0].perm = perm;
+   jobs[0].indcomp = graph->symtype == SYM_SYMTYPE_PERM ? SYMsortVarnodesPermsym : SYMsortVarnodesSignedPermsym;
+   jobs[0].dataptr = (void*) graph;
+   jobs[0].len = nusedvars;
+   jobs[1].perm = jobs[0].perm + jobs[0].len;
+   jobs[1].indcomp = SYMsortOpnodes;
+   jobs[1].dataptr = (void*) graph->ops;
+   jobs[1].len = graph->nopnodes;
+   jobs[2].perm = jobs[1].perm + jobs[1].len;
+   jobs[2].indcomp = SYMsortReals;
+   jobs[2].dataptr = (void*) graph->vals;
+   jobs[2].len = graph->nvalnodes;
+   jobs[3].perm = jobs[2].perm + jobs[2].len;
+   jobs[3].indcomp = SYMsortConsnodes;
+   jobs[3].dataptr = (void*) graph;
+   jobs[3].len = graph->nconsnodes;
+   jobs[4].perm = jobs[3].perm + jobs[3].len;
+   jobs[4].indcomp = SYMsortEdges;
+   jobs[4].dataptr = (void*) graph;
+   jobs[4].len = graph->nedges;
+
+   if( nthreads > 1 && len >= MINPARALLELSORTSIZE && SCIPtpiIsAvailable() )
+   {
+      for( i = 0; i < 5; ++i )
+         jobargs[i] = (void*) &jobs[i];
+
+      SCIP_CALL( SCIPtpiExecuteJobs(symSortJob, jobargs, 5, nthreads) );
+   }
+   else
+   {
+      for( i = 0; i < 5; ++i )
+      {
+         SCIP_CALL( symSortJob((void*) &jobs[i]) );
+      }
+   }
+
+   /* find colors of variable nodes */
+   perm = jobs[0].perm;
    switch( graph->symtype )
    {
    case SYM_SYMTYPE_PERM:
-      SCIPsort(perm, SYMsortVarnodesPermsym, (void*) graph, nusedvars);
-
       graph->varcolors[perm[0]] = color;
       prevvar = graph->symvars[perm[0]];
 
@@ -1421,8 +1497,6 @@ SCIP_RETCODE SCIPcomputeSymgraphColors(
    default:
       assert(graph->symtype == SYM_SYMTYPE_SIGNPERM);
 
-      SCIPsort(perm, SYMsortVarnodesSignedPermsym, (void*) graph, nusedvars);
-
       graph->varcolors[perm[0]] = color;
 
       /* store information about first variable */
@@ -1468,7 +1542,7 @@ SCIP_RETCODE SCIPcomputeSymgraphColors(
       int prevop;
       int thisop;
 
-      SCIPsort(perm, SYMsortOpnodes, (void*) graph->ops, graph->nopnodes);
+      perm = jobs[1].perm;
 
       graph->opcolors[perm[0]] = ++color;
       prevop = graph->ops[perm[0]];
@@ -1488,7 +1562,7 @@ SCIP_RETCODE SCIPcomputeSymgraphColors(
    /* find colors of value nodes */
    if( graph->nvalnodes > 0 )
    {
-      SCIPsort(perm, SYMsortReals, (void*) graph->vals, graph->nvalnodes);
+      perm = jobs[2].perm;
 
       graph->valcolors[perm[0]] = ++color;
       prevval = graph->vals[perm[0]];
@@ -1508,7 +1582,7 @@ SCIP_RETCODE SCIPcomputeSymgraphColors(
    /* find colors of constraint nodes */
    if( graph->nconsnodes > 0 )
    {
-      SCIPsort(perm, SYMsortConsnodes, (void*) graph, graph->nconsnodes);
+      perm = jobs[3].perm;
 
       graph->conscolors[perm[0]] = ++color;
 
@@ -1524,7 +1598,7 @@ SCIP_RETCODE SCIPcomputeSymgraphColors(
    /* find colors of edges */
    if( graph->nedges > 0 )
    {
-      SCIPsort(perm, SYMsortEdges, (void*) graph, graph->nedges);
+      perm = jobs[4].perm;
 
       /* check whether edges are colored; due to sorting, only check first edge */
       if( SCIPisInfinity(scip, graph->edgevals[perm[0]]) )
@@ -1564,6 +1638,7 @@ SCIP_RETCODE SCIPcomputeSymgraphColors(
       }
    }
 
+   perm = jobs[0].perm;
    SCIPfreeBufferArray(scip, &perm);
 
    return SCIP_OKAY;
@@ -1767,6 +1842,68 @@ SCIP_Bool SCIPhasGraphUniqueEdgetype(
    return graph->uniqueedgetype;
 }
 
+/** mixes a value into a hash value of a symmetry detection graph */
+static
+uint64_t symgraphHashMix(
+   uint64_t              hash,               /**< current hash value */
+   int                   val                 /**< value to be mixed into the hash value */
+   )
+{
+   hash ^= (uint64_t) (int64_t) val;
+   hash += UINT64_C(0x9e3779b97f4a7c15);
+   hash = (hash ^ (hash >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+   hash = (hash ^ (hash >> 27)) * UINT64_C(0x94d049bb133111eb);
+
+   return hash ^ (hash >> 31);
+}
+
+/** returns a hash value of the colored symmetry detection graph
+ *
+ *  The hash value depends on the node types, the edges, and the colors of the nodes and edges, but not on the values
+ *  the colors have been computed from. Thus, graphs with the same hash value have the same automorphisms (up to hash
+ *  collisions). Different seeds yield independent hash values.
+ *
+ *  @note @p colors of symmetry detection graph must have been computed
+ */
+uint64_t SCIPgetSymgraphHash(
+   SYM_GRAPH*            graph,              /**< symmetry detection graph */
+   uint64_t              seed                /**< seed of the hash value */
+   )
+{
+   uint64_t hash;
+   int nvarnodes;
+   int i;
+
+   assert(graph != NULL);
+   assert(graph->islocked);
+
+   nvarnodes = graph->symtype == SYM_SYMTYPE_PERM ? graph->nsymvars : 2 * graph->nsymvars;
+
+   hash = symgraphHashMix(seed, (int) graph->symtype);
+   hash = symgraphHashMix(hash, graph->nsymvars);
+   hash = symgraphHashMix(hash, graph->nnodes);
+   hash = symgraphHashMix(hash, graph->nedges);
+   hash = symgraphHashMix(hash, (int) graph->uniqueedgetype);
+
+   for( i = 0; i < nvarnodes; ++i )
+      hash = symgraphHashMix(hash, graph->varcolors[i]);
+
+   for( i = 0; i < graph->nnodes; ++i )
+   {
+      hash = symgraphHashMix(hash, (int) graph->nodetypes[i]);
+      hash = symgraphHashMix(hash, SCIPgetSymgraphNodeColor(graph, i));
+   }
+
+   for( i = 0; i < graph->nedges; ++i )
+   {
+      hash = symgraphHashMix(hash, graph->edgefirst[i]);
+      hash = symgraphHashMix(hash, graph->edgesecond[i]);
+      hash = symgraphHashMix(hash, graph->edgecolors[i]);
+   }
+
+   return hash;
+}
+
 /** creates consnodeperm array for symmetry detection graph
  *
  *  @note @p colors of symmetry detection graph must have been computed
@@ -241,6 +241,18 @@ SCIP_RETCODE SCIPcomputeSymgraphColors(
    SYM_SPEC              fixedtype           /**< variable types that must be fixed by symmetries */
    );
 
+/** computes colors of nodes and edges, where the different types of nodes and the edges are sorted in parallel
+ *
+ *  The computed colors are the same as the ones of SCIPcomputeSymgraphColors().
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputeSymgraphColorsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SYM_GRAPH*            graph,              /**< symmetry detection graph */
+   SYM_SPEC              fixedtype,          /**< variable types that must be fixed by symmetries */
+   int                   nthreads            /**< maximal number of threads used for sorting (1: sequential) */
+   );
+
 /*
  * general methods
  */
@@ -342,6 +354,20 @@ SCIP_Bool SCIPhasGraphUniqueEdgetype(
    SYM_GRAPH*            graph               /**< symmetry detection graph */
    );
 
+/** returns a hash value of the colored symmetry detection graph
+ *
+ *  The hash value depends on the node types, the edges, and the colors of the nodes and edges, but not on the values
+ *  the colors have been computed from. Thus, graphs with the same hash value have the same automorphisms (up to hash
+ *  collisions). Different seeds yield independent hash values.
+ *
+ *  @note @p colors of symmetry detection graph must have been computed
+ */
+SCIP_EXPORT
+uint64_t SCIPgetSymgraphHash(
+   SYM_GRAPH*            graph,              /**< symmetry detection graph */
+   uint64_t              seed                /**< seed of the hash value */
+   );
+
 /** creates consnodeperm array for symmetry detection graph
  *
  *  @note @p colors of symmetry detection graph must have been computed
@@ -53,6 +53,7 @@
 
 typedef struct SCIP_ExprData  SCIP_EXPRDATA;     /**< expression data, e.g., coefficients */
 typedef struct SCIP_Expr      SCIP_EXPR;         /**< expression */
+typedef struct SCIP_ExprTape  SCIP_EXPRTAPE;     /**< compiled evaluation tape of an expression */
 typedef struct SYM_ExprData   SYM_EXPRDATA;      /**< (additional) data used to encode an expression,
                                                   *   which is not encoded as another expression */
 
@@ -429,6 +430,31 @@ typedef struct SCIP_ExprhdlrData SCIP_EXPRHDLRDATA; /**< expression handler data
    SCIP_Real* val,  \
    SCIP_SOL*  sol)
 
+/** batched point evaluation callback
+ *
+ * The method evaluates an expression at a block of points, given the values of its children at these points.
+ * The values are stored in structure-of-arrays layout, that is, childvals[c][p] is the value of the c-th child
+ * at the p-th point.
+ * If a child value is SCIP_INVALID or the expression cannot be evaluated at a point, then the value of the
+ * expression at this point needs to be set to SCIP_INVALID.
+ *
+ * The callback is optional. If not implemented, the point evaluation callback is called for each point.
+ *
+ *  \param[in] scip      SCIP main data structure
+ *  \param[in] expr      expression to be evaluated
+ *  \param[in] childvals values of children at the points
+ *  \param[out] vals     buffer to store the values of the expression at the points
+ *  \param[in] npoints   number of points
+ *
+ * See also \ref EXPREVALBATCH.
+ */
+#define SCIP_DECL_EXPREVALBATCH(x) SCIP_RETCODE x (\
+   SCIP*       scip,      \
+   SCIP_EXPR*  expr,      \
+   SCIP_Real** childvals, \
+   SCIP_Real*  vals,      \
+   int         npoints)
+
 /** backward derivative evaluation callback
  *
  * The method should compute the partial derivative of expr w.r.t. its child at childidx.
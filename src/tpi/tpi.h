@@ -138,6 +138,61 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    int                   jobid               /**< the jobid of the jobs to wait for */
    );
 
+/** executes the given jobs in parallel on at most nthreads threads and blocks until all of them have finished;
+ *  returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  In contrast to SCIPtpiSubmitJob(), this does not use the thread pool that is created by SCIPtpiInit(), but starts
+ *  its own threads. It can therefore be used while a (sequential or concurrent) solve is running and by several
+ *  threads at the same time. The calling thread processes jobs as well. If no TPI is available, all jobs are executed
+ *  sequentially in the calling thread.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtpiExecuteJobs(
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads            /**< maximal number of threads to use, including the calling thread */
+   );
+
+/** starts the given jobs on at most nthreads new threads and returns without waiting for them to finish
+ *
+ *  The job batch has to be passed to SCIPtpiWaitJobs() eventually, which waits for the jobs and frees the batch. The
+ *  job arguments have to stay valid until then. If the jobs cannot be executed asynchronously, e.g., because no TPI
+ *  with threads is available, they are executed in the calling thread before this function returns.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtpiStartJobs(
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads,           /**< maximal number of threads to use */
+   SCIP_JOBBATCH**       jobbatch            /**< pointer to store the started job batch */
+   );
+
+/** returns whether SCIPtpiStartJobs() executes jobs in the background
+ *
+ *  If this returns FALSE, SCIPtpiStartJobs() executes the jobs before it returns, such that callers that rely on the
+ *  calling thread to continue while the jobs are running should not use it.
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPtpiCanStartJobs(
+   void
+   );
+
+/** returns whether all jobs of a job batch started by SCIPtpiStartJobs() have finished */
+SCIP_EXPORT
+SCIP_Bool SCIPtpiJobsFinished(
+   SCIP_JOBBATCH*        jobbatch            /**< job batch */
+   );
+
+/** waits until all jobs of a job batch started by SCIPtpiStartJobs() have finished and frees the batch;
+ *  returns the smallest SCIP_RETCODE of all the jobs
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtpiWaitJobs(
+   SCIP_JOBBATCH**       jobbatch            /**< pointer to the job batch */
+   );
+
 /** initializes tpi */
 SCIP_EXPORT
 SCIP_RETCODE SCIPtpiInit(
@@ -592,6 +592,113 @@ SCIP_RETCODE SCIPtpiCollectJobs(
    return retcode;
 }
 
+/** executes the given jobs in parallel on at most nthreads threads and blocks until all of them have finished;
+ *  returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  In contrast to SCIPtpiSubmitJob(), this does not use the thread pool that is created by SCIPtpiInit(), but starts
+ *  its own threads. It can therefore be used while a (sequential or concurrent) solve is running and by several
+ *  threads at the same time. The calling thread processes jobs as well. If no TPI is available, all jobs are executed
+ *  sequentially in the calling thread.
+ */
+SCIP_RETCODE SCIPtpiExecuteJobs(
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads            /**< maximal number of threads to use, including the calling thread */
+   )
+{
+   SCIP_RETCODE retcode;
+   int i;
+
+   assert(jobfunc != NULL);
+   assert(jobargs != NULL || njobs == 0);
+
+   retcode = SCIP_OKAY;
+   nthreads = MIN(nthreads, njobs);
+
+   #pragma omp parallel for num_threads(MAX(nthreads, 1)) schedule(dynamic, 1)
+   for( i = 0; i < njobs; ++i )
+   {
+      SCIP_RETCODE jobretcode;
+
+      jobretcode = (*jobfunc)(jobargs[i]);
+
+      #pragma omp critical (executejobs)
+      retcode = MIN(retcode, jobretcode);
+   }
+
+   return retcode;
+}
+
+/** jobs that are executed by SCIPtpiStartJobs() */
+struct SCIP_JobBatch
+{
+   SCIP_RETCODE          retcode;            /**< smallest return code of the jobs */
+};
+
+/** starts the given jobs on at most nthreads new threads and returns without waiting for them to finish
+ *
+ *  The job batch has to be passed to SCIPtpiWaitJobs() eventually, which waits for the jobs and frees the batch. The
+ *  job arguments have to stay valid until then. If the jobs cannot be executed asynchronously, e.g., because no TPI
+ *  with threads is available, they are executed in the calling thread before this function returns.
+ */
+SCIP_RETCODE SCIPtpiStartJobs(
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads,           /**< maximal number of threads to use */
+   SCIP_JOBBATCH**       jobbatch            /**< pointer to store the started job batch */
+   )
+{
+   assert(jobbatch != NULL);
+
+   SCIP_ALLOC( BMSallocMemory(jobbatch) );
+
+   /* OpenMP offers no way to leave a parallel region running, so the jobs are executed (in parallel) right away */
+   (*jobbatch)->retcode = SCIPtpiExecuteJobs(jobfunc, jobargs, njobs, nthreads);
+
+   return SCIP_OKAY;
+}
+
+/** returns whether SCIPtpiStartJobs() executes jobs in the background */
+SCIP_Bool SCIPtpiCanStartJobs(
+   void
+   )
+{
+   /* OpenMP offers no way to leave a parallel region running */
+   return FALSE;
+}
+
+/** returns whether all jobs of a job batch started by SCIPtpiStartJobs() have finished */
+SCIP_Bool SCIPtpiJobsFinished(
+   SCIP_JOBBATCH*        jobbatch            /**< job batch */
+   )
+{
+   assert(jobbatch != NULL);
+
+   SCIP_UNUSED( jobbatch );
+
+   return TRUE;
+}
+
+/** waits until all jobs of a job batch started by SCIPtpiStartJobs() have finished and frees the batch;
+ *  returns the smallest SCIP_RETCODE of all the jobs
+ */
+SCIP_RETCODE SCIPtpiWaitJobs(
+   SCIP_JOBBATCH**       jobbatch            /**< pointer to the job batch */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   assert(jobbatch != NULL);
+   assert(*jobbatch != NULL);
+
+   retcode = (*jobbatch)->retcode;
+   BMSfreeMemory(jobbatch);
+
+   return retcode;
+}
+
 /** initializes tpi */
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
@@ -254,6 +254,58 @@ int threadPoolThread(
    return (int) threadPoolThreadRetcode(threadnum);
 }
 
+/** jobs that are executed by SCIPtpiExecuteJobs() or SCIPtpiStartJobs() */
+struct SCIP_JobBatch
+{
+   mtx_t                 lock;               /**< mutex to protect the job counters and the return code */
+   SCIP_RETCODE          (*jobfunc)(void* args);/**< pointer to the job function */
+   void**                jobargs;            /**< arguments of the jobs */
+   thrd_t*               threads;            /**< threads started by SCIPtpiStartJobs(), or NULL */
+   int                   nthreads;           /**< number of threads started by SCIPtpiStartJobs() */
+   int                   njobs;              /**< number of jobs */
+   int                   nextjob;            /**< index of the next job that has not been started yet */
+   int                   nfinished;          /**< number of finished jobs */
+   SCIP_RETCODE          retcode;            /**< smallest return code of the finished jobs */
+};
+
+/** processes jobs of a job batch until all of them have been started */
+static
+int jobBatchThread(
+   void*                 batchptr            /**< the job batch stored inside a void pointer */
+   )
+{
+   SCIP_JOBBATCH* batch;
+
+   batch = (SCIP_JOBBATCH*) batchptr;
+   assert(batch != NULL);
+
+   while( TRUE ) /*lint !e716*/
+   {
+      SCIP_RETCODE jobretcode;
+      int jobidx;
+
+      if( SCIPtnyAcquireLock(&batch->lock) != SCIP_OKAY )
+         return (int) SCIP_ERROR;
+      jobidx = batch->nextjob++;
+      if( SCIPtnyReleaseLock(&batch->lock) != SCIP_OKAY )
+         return (int) SCIP_ERROR;
+
+      if( jobidx >= batch->njobs )
+         break;
+
+      jobretcode = (*batch->jobfunc)(batch->jobargs[jobidx]);
+
+      if( SCIPtnyAcquireLock(&batch->lock) != SCIP_OKAY )
+         return (int) SCIP_ERROR;
+      batch->retcode = MIN(batch->retcode, jobretcode);
+      ++batch->nfinished;
+      if( SCIPtnyReleaseLock(&batch->lock) != SCIP_OKAY )
+         return (int) SCIP_ERROR;
+   }
+
+   return (int) SCIP_OKAY;
+}
+
 /** creates a threadpool */
 static
 SCIP_RETCODE createThreadPool(
@@ -578,6 +630,200 @@ int SCIPtpiGetNumThreads(
    return _threadpool != NULL ? _threadpool->nthreads : 0;
 }
 
+/** executes the given jobs in parallel on at most nthreads threads and blocks until all of them have finished;
+ *  returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  In contrast to SCIPtpiSubmitJob(), this does not use the thread pool that is created by SCIPtpiInit(), but starts
+ *  its own threads. It can therefore be used while a (sequential or concurrent) solve is running and by several
+ *  threads at the same time. The calling thread processes jobs as well. If no TPI is available, all jobs are executed
+ *  sequentially in the calling thread.
+ */
+SCIP_RETCODE SCIPtpiExecuteJobs(
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads            /**< maximal number of threads to use, including the calling thread */
+   )
+{
+   SCIP_JOBBATCH batch;
+   thrd_t* threads;
+   SCIP_RETCODE retcode;
+   int nstarted;
+   int i;
+
+   assert(jobfunc != NULL);
+   assert(jobargs != NULL || njobs == 0);
+
+   /* process the jobs in the calling thread if no additional threads are needed */
+   if( nthreads <= 1 || njobs <= 1 )
+   {
+      retcode = SCIP_OKAY;
+      for( i = 0; i < njobs; ++i )
+      {
+         SCIP_RETCODE jobretcode;
+
+         jobretcode = (*jobfunc)(jobargs[i]);
+         retcode = MIN(retcode, jobretcode);
+      }
+
+      return retcode;
+   }
+
+   nthreads = MIN(nthreads, njobs);
+
+   batch.jobfunc = jobfunc;
+   batch.jobargs = jobargs;
+   batch.njobs = njobs;
+   batch.threads = NULL;
+   batch.nthreads = 0;
+   batch.nextjob = 0;
+   batch.nfinished = 0;
+   batch.retcode = SCIP_OKAY;
+   SCIP_CALL( SCIPtnyInitLock(&batch.lock) ); /*lint !e2482*/
+
+   SCIP_ALLOC( BMSallocMemoryArray(&threads, nthreads - 1) );
+
+   /* start the additional threads; if a thread cannot be created, its jobs are taken over by the others */
+   nstarted = 0;
+   for( i = 0; i < nthreads - 1; ++i )
+   {
+      if( thrd_create(&threads[nstarted], jobBatchThread, (void*)&batch) == thrd_success )
+         ++nstarted;
+   }
+
+   /* the calling thread processes jobs as well */
+   retcode = (SCIP_RETCODE) jobBatchThread((void*)&batch);
+
+   for( i = 0; i < nstarted; ++i )
+   {
+      int threadretcode;
+
+      if( thrd_join(threads[i], &threadretcode) != thrd_success )
+         threadretcode = (int) SCIP_ERROR;
+      retcode = MIN(retcode, (SCIP_RETCODE) threadretcode);
+   }
+
+   BMSfreeMemoryArray(&threads);
+   SCIPtnyDestroyLock(&batch.lock);
+
+   return MIN(retcode, batch.retcode);
+}
+
+/** starts the given jobs on at most nthreads new threads and returns without waiting for them to finish
+ *
+ *  The job batch has to be passed to SCIPtpiWaitJobs() eventually, which waits for the jobs and frees the batch. The
+ *  job arguments have to stay valid until then. If the jobs cannot be executed asynchronously, e.g., because no TPI
+ *  with threads is available, they are executed in the calling thread before this function returns.
+ */
+SCIP_RETCODE SCIPtpiStartJobs(
+   SCIP_RETCODE          (*jobfunc)(void* args),/**< pointer to the job function */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs,              /**< number of jobs */
+   int                   nthreads,           /**< maximal number of threads to use */
+   SCIP_JOBBATCH**       jobbatch            /**< pointer to store the started job batch */
+   )
+{
+   SCIP_JOBBATCH* batch;
+   int i;
+
+   assert(jobfunc != NULL);
+   assert(jobargs != NULL || njobs == 0);
+   assert(jobbatch != NULL);
+
+   SCIP_ALLOC( BMSallocMemory(jobbatch) );
+   batch = *jobbatch;
+
+   batch->jobfunc = jobfunc;
+   batch->jobargs = jobargs;
+   batch->njobs = njobs;
+   batch->nextjob = 0;
+   batch->nfinished = 0;
+   batch->retcode = SCIP_OKAY;
+   batch->threads = NULL;
+   batch->nthreads = 0;
+   SCIP_CALL( SCIPtnyInitLock(&batch->lock) ); /*lint !e2482*/
+
+   nthreads = MIN(nthreads, njobs);
+
+   if( nthreads >= 1 )
+   {
+      SCIP_ALLOC( BMSallocMemoryArray(&batch->threads, nthreads) );
+
+      for( i = 0; i < nthreads; ++i )
+      {
+         if( thrd_create(&batch->threads[batch->nthreads], jobBatchThread, (void*)batch) == thrd_success )
+            ++batch->nthreads;
+      }
+   }
+
+   /* if no thread could be started, the calling thread processes the jobs */
+   if( batch->nthreads == 0 )
+   {
+      SCIP_RETCODE retcode;
+
+      retcode = (SCIP_RETCODE) jobBatchThread((void*)batch);
+      batch->retcode = MIN(batch->retcode, retcode);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns whether SCIPtpiStartJobs() executes jobs in the background */
+SCIP_Bool SCIPtpiCanStartJobs(
+   void
+   )
+{
+   return TRUE;
+}
+
+/** returns whether all jobs of a job batch started by SCIPtpiStartJobs() have finished */
+SCIP_Bool SCIPtpiJobsFinished(
+   SCIP_JOBBATCH*        jobbatch            /**< job batch */
+   )
+{
+   SCIP_Bool finished;
+
+   assert(jobbatch != NULL);
+
+   if( SCIPtnyAcquireLock(&jobbatch->lock) != SCIP_OKAY )
+      return FALSE;
+   finished = (jobbatch->nfinished >= jobbatch->njobs);
+   (void) SCIPtnyReleaseLock(&jobbatch->lock);
+
+   return finished;
+}
+
+/** waits until all jobs of a job batch started by SCIPtpiStartJobs() have finished and frees the batch;
+ *  returns the smallest SCIP_RETCODE of all the jobs
+ */
+SCIP_RETCODE SCIPtpiWaitJobs(
+   SCIP_JOBBATCH**       jobbatch            /**< pointer to the job batch */
+   )
+{
+   SCIP_RETCODE retcode;
+   int i;
+
+   assert(jobbatch != NULL);
+   assert(*jobbatch != NULL);
+
+   retcode = SCIP_OKAY;
+   for( i = 0; i < (*jobbatch)->nthreads; ++i )
+   {
+      int threadretcode;
+
+      if( thrd_join((*jobbatch)->threads[i], &threadretcode) != thrd_success )
+         threadretcode = (int) SCIP_ERROR;
+      retcode = MIN(retcode, (SCIP_RETCODE) threadretcode);
+   }
+   retcode = MIN(retcode, (*jobbatch)->retcode);
+
+   BMSfreeMemoryArrayNull(&(*jobbatch)->threads);
+   SCIPtnyDestroyLock(&(*jobbatch)->lock);
+   BMSfreeMemory(jobbatch);
+
+   return retcode;
+}
+
 /** initializes tpi */
 SCIP_RETCODE SCIPtpiInit(
    int                   nthreads,           /**< the number of threads to be used */
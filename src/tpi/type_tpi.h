@@ -65,6 +65,7 @@ enum SCIP_Jobstatus
 typedef enum SCIP_Jobstatus SCIP_JOBSTATUS;
 
 typedef struct SCIP_Job SCIP_JOB;            /**< a job to be submitted to a separate thread */
+typedef struct SCIP_JobBatch SCIP_JOBBATCH;  /**< a batch of jobs that is executed on its own threads */
 
 
 typedef struct SCIP_Lock SCIP_LOCK;          /**< TPI type dependent lock */
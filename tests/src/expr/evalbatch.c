@@ -0,0 +1,175 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   evalbatch.c
+ * @brief  tests evaluation of expressions at blocks of points
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "include/scip_test.h"
+
+#define NPOINTS 7
+
+static SCIP* scip;
+static SCIP_SOL* sol;
+static SCIP_VAR* x;
+static SCIP_VAR* y;
+static SCIP_EXPR* expr;
+
+/* values of x and y at the points; log(x) and sqrt(x) cannot be evaluated for the first two points */
+static SCIP_Real xvals[NPOINTS] = {-1.0, 0.0, 0.25, 0.5, 1.0, 1.5, 2.0};
+static SCIP_Real yvals[NPOINTS] = {1.0, -2.0, 3.0, -0.5, 0.0, 1.5, -3.0};
+
+/* creates the expression 1 + exp(x*y) + log(x) + x^0.5 + sign(y)|y|^3 + |x| */
+static
+void setup(void)
+{
+   SCIP_EXPR* children[5];
+   SCIP_EXPR* xexpr;
+   SCIP_EXPR* yexpr;
+   SCIP_EXPR* prodexpr;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "test_problem") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &x, "x", -1.0, 2.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &y, "y", -3.0, 3.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, x) );
+   SCIP_CALL( SCIPaddVar(scip, y) );
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   SCIP_CALL( SCIPcreateExprVar(scip, &xexpr, x, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprVar(scip, &yexpr, y, NULL, NULL) );
+
+   children[0] = xexpr;
+   children[1] = yexpr;
+   SCIP_CALL( SCIPcreateExprProduct(scip, &prodexpr, 2, children, 1.0, NULL, NULL) );
+
+   SCIP_CALL( SCIPcreateExprExp(scip, &children[0], prodexpr, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprLog(scip, &children[1], xexpr, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprPow(scip, &children[2], xexpr, 0.5, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprSignpower(scip, &children[3], yexpr, 3.0, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprAbs(scip, &children[4], xexpr, NULL, NULL) );
+
+   SCIP_CALL( SCIPcreateExprSum(scip, &expr, 5, children, NULL, 1.0, NULL, NULL) );
+
+   for( i = 0; i < 5; ++i )
+   {
+      SCIP_CALL( SCIPreleaseExpr(scip, &children[i]) );
+   }
+   SCIP_CALL( SCIPreleaseExpr(scip, &prodexpr) );
+   SCIP_CALL( SCIPreleaseExpr(scip, &yexpr) );
+   SCIP_CALL( SCIPreleaseExpr(scip, &xexpr) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   SCIP_CALL( SCIPreleaseVar(scip, &x) );
+   SCIP_CALL( SCIPreleaseVar(scip, &y) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/* compares the values at all points with evaluations at the single points */
+static
+void checkValues(
+   SCIP_Real*            vals
+   )
+{
+   int p;
+
+   for( p = 0; p < NPOINTS; ++p )
+   {
+      SCIP_CALL( SCIPsetSolVal(scip, sol, x, xvals[p]) );
+      SCIP_CALL( SCIPsetSolVal(scip, sol, y, yvals[p]) );
+      SCIP_CALL( SCIPevalExpr(scip, expr, sol, 0L) );
+
+      if( SCIPexprGetEvalValue(expr) == SCIP_INVALID )
+         cr_expect(vals[p] == SCIP_INVALID, "point %d: expected invalid value, got %g", p, vals[p]);
+      else
+         cr_expect(SCIPisEQ(scip, vals[p], SCIPexprGetEvalValue(expr)), "point %d: expected %g, got %g", p,
+            SCIPexprGetEvalValue(expr), vals[p]);
+   }
+}
+
+TestSuite(evalbatch, .init = setup, .fini = teardown);
+
+Test(evalbatch, probindex, .description = "checks batched evaluation with values ordered by problem indices")
+{
+   SCIP_Real varvals[2 * NPOINTS];
+   SCIP_Real vals[NPOINTS];
+   int p;
+
+   for( p = 0; p < NPOINTS; ++p )
+   {
+      varvals[SCIPvarGetProbindex(x) * NPOINTS + p] = xvals[p];
+      varvals[SCIPvarGetProbindex(y) * NPOINTS + p] = yvals[p];
+   }
+
+   SCIP_CALL( SCIPevalExprBatch(scip, expr, NPOINTS, NULL, varvals, vals) );
+
+   cr_expect(vals[0] == SCIP_INVALID);
+   cr_expect(vals[1] == SCIP_INVALID);
+   cr_expect(SCIPisEQ(scip, vals[4], 1.0 + 1.0 + 0.0 + 1.0 + 0.0 + 1.0));
+   checkValues(vals);
+
+   /* evaluation on a compiled tape gives the same values */
+   SCIP_CALL( SCIPcompileExpr(scip, expr) );
+   SCIP_CALL( SCIPevalExprBatch(scip, expr, NPOINTS, NULL, varvals, vals) );
+   checkValues(vals);
+}
+
+Test(evalbatch, varidxs, .description = "checks batched evaluation with values ordered by a given variable map")
+{
+   SCIP_HASHMAP* varidxs;
+   SCIP_Real varvals[3 * NPOINTS];
+   SCIP_Real vals[NPOINTS];
+   int p;
+
+   /* y is stored first, the values of x come after a block of unused values */
+   SCIP_CALL( SCIPhashmapCreate(&varidxs, SCIPblkmem(scip), 2) );
+   SCIP_CALL( SCIPhashmapInsertInt(varidxs, (void*)y, 0) );
+   SCIP_CALL( SCIPhashmapInsertInt(varidxs, (void*)x, 2) );
+
+   for( p = 0; p < NPOINTS; ++p )
+   {
+      varvals[p] = yvals[p];
+      varvals[NPOINTS + p] = SCIP_INVALID;
+      varvals[2 * NPOINTS + p] = xvals[p];
+   }
+
+   SCIP_CALL( SCIPevalExprBatch(scip, expr, NPOINTS, varidxs, varvals, vals) );
+   checkValues(vals);
+
+   SCIPhashmapFree(&varidxs);
+}
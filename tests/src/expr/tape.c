@@ -0,0 +1,223 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   tape.c
+ * @brief  tests evaluation of expressions that are compiled into evaluation tapes
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_expr.h"
+#include "scip/struct_scip.h"
+#include "scip/struct_stat.h"
+#include "include/scip_test.h"
+
+static SCIP* scip;
+static SCIP_SOL* sol;
+static SCIP_VAR* x;
+static SCIP_VAR* y;
+static SCIP_EXPR* xexpr;
+static SCIP_EXPR* yexpr;
+static SCIP_EXPR* absexpr;
+static SCIP_EXPR* expr;
+
+/* creates the expression exp(x*y) + log(x*y) + (x*y)^2 + |x|, where x*y and x are shared subexpressions */
+static
+void setup(void)
+{
+   SCIP_EXPR* children[4];
+   SCIP_EXPR* prodexpr;
+   SCIP_Real coefs[4] = {1.0, 1.0, 1.0, 1.0};
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetRealParam(scip, "expr/log/minzerodistance", 0.0) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "test_problem") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &x, "x", 0.5, 2.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &y, "y", 1.0, 3.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, x) );
+   SCIP_CALL( SCIPaddVar(scip, y) );
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   SCIP_CALL( SCIPcreateExprVar(scip, &xexpr, x, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprVar(scip, &yexpr, y, NULL, NULL) );
+
+   children[0] = xexpr;
+   children[1] = yexpr;
+   SCIP_CALL( SCIPcreateExprProduct(scip, &prodexpr, 2, children, 1.0, NULL, NULL) );
+
+   SCIP_CALL( SCIPcreateExprExp(scip, &children[0], prodexpr, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprLog(scip, &children[1], prodexpr, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprPow(scip, &children[2], prodexpr, 2.0, NULL, NULL) );
+   SCIP_CALL( SCIPcreateExprAbs(scip, &children[3], xexpr, NULL, NULL) );
+   absexpr = children[3];
+
+   SCIP_CALL( SCIPcreateExprSum(scip, &expr, 4, children, coefs, 0.0, NULL, NULL) );
+
+   for( i = 0; i < 4; ++i )
+   {
+      SCIP_CALL( SCIPreleaseExpr(scip, &children[i]) );
+   }
+   SCIP_CALL( SCIPreleaseExpr(scip, &prodexpr) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPreleaseExpr(scip, &expr) );
+   SCIP_CALL( SCIPreleaseExpr(scip, &yexpr) );
+   SCIP_CALL( SCIPreleaseExpr(scip, &xexpr) );
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   SCIP_CALL( SCIPreleaseVar(scip, &x) );
+   SCIP_CALL( SCIPreleaseVar(scip, &y) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(tape, .init = setup, .fini = teardown);
+
+Test(tape, compile, .description = "checks that each distinct subexpression is stored once and children come first")
+{
+   int i;
+
+   SCIP_CALL( SCIPcompileExpr(scip, expr) );
+   cr_assert(expr->tape != NULL);
+
+   /* x, y, x*y, exp, log, pow, abs, sum */
+   cr_expect_eq(expr->tape->nops, 8);
+   cr_expect(expr->tape->exprs[expr->tape->nops - 1] == expr);
+
+   for( i = 0; i < expr->tape->nops; ++i )
+   {
+      int c;
+
+      for( c = expr->tape->childbegin[i]; c < expr->tape->childbegin[i+1]; ++c )
+         cr_expect(expr->tape->childpos[c] < i);
+   }
+
+   SCIPfreeExprTape(scip, expr);
+   cr_expect(expr->tape == NULL);
+}
+
+Test(tape, evalgradient, .description = "checks value and gradient evaluation on the tape")
+{
+   int i;
+
+   SCIP_CALL( SCIPcompileExpr(scip, expr) );
+
+   for( i = 1; i <= 5; ++i )
+   {
+      SCIP_Real xval = 0.3 * i;
+      SCIP_Real yval = 2.0 - 0.25 * i;
+      SCIP_Real xy = xval * yval;
+      SCIP_Real dfdxy = exp(xy) + 1.0 / xy + 2.0 * xy;
+
+      SCIP_CALL( SCIPsetSolVal(scip, sol, x, xval) );
+      SCIP_CALL( SCIPsetSolVal(scip, sol, y, yval) );
+
+      SCIP_CALL( SCIPevalExprGradient(scip, expr, sol, 0L) );
+
+      cr_expect(SCIPisRelEQ(scip, SCIPexprGetEvalValue(expr), exp(xy) + log(xy) + xy * xy + xval));
+      cr_expect(SCIPisRelEQ(scip, SCIPexprGetEvalValue(absexpr), xval));
+      cr_expect(SCIPisRelEQ(scip, SCIPexprGetDerivative(xexpr), dfdxy * yval + 1.0), "df/dx = %g, expected %g",
+         SCIPexprGetDerivative(xexpr), dfdxy * yval + 1.0);
+      cr_expect(SCIPisRelEQ(scip, SCIPexprGetDerivative(yexpr), dfdxy * xval), "df/dy = %g, expected %g",
+         SCIPexprGetDerivative(yexpr), dfdxy * xval);
+   }
+
+   /* log(x*y) cannot be evaluated for x = 0 */
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 0.0) );
+   SCIP_CALL( SCIPevalExprGradient(scip, expr, sol, 0L) );
+   cr_expect_eq(SCIPexprGetEvalValue(expr), SCIP_INVALID);
+   cr_expect_eq(SCIPexprGetDerivative(expr), SCIP_INVALID);
+}
+
+Test(tape, soltag, .description = "checks that values of subexpressions evaluated for the same solution are reused")
+{
+   SCIP_Longint soltag;
+
+   SCIP_CALL( SCIPcompileExpr(scip, expr) );
+
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 1.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, y, 1.0) );
+   soltag = SCIPgetExprNewSoltag(scip);
+
+   /* evaluating a subexpression first leaves the remaining subexpressions to the tape */
+   SCIP_CALL( SCIPevalExpr(scip, absexpr, sol, soltag) );
+   SCIP_CALL( SCIPevalExprGradient(scip, expr, sol, soltag) );
+   cr_expect(SCIPisRelEQ(scip, SCIPexprGetEvalValue(expr), exp(1.0) + 1.0 + 1.0));
+   cr_expect(SCIPisRelEQ(scip, SCIPexprGetDerivative(xexpr), exp(1.0) + 1.0 + 2.0 + 1.0));
+
+   /* the gradient of an expression that has been evaluated for the solution already uses the stored values */
+   SCIP_CALL( SCIPevalExprGradient(scip, expr, sol, soltag) );
+   cr_expect(SCIPisRelEQ(scip, SCIPexprGetDerivative(yexpr), exp(1.0) + 1.0 + 2.0));
+}
+
+Test(tape, activity, .description = "checks interval evaluation on the tape")
+{
+   SCIP_EXPR* copyexpr;
+   SCIP_INTERVAL activity;
+   SCIP_INTERVAL copyactivity;
+
+   SCIP_CALL( SCIPduplicateExpr(scip, expr, &copyexpr, NULL, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPcompileExpr(scip, expr) );
+
+   SCIP_CALL( SCIPevalExprActivity(scip, expr) );
+   SCIP_CALL( SCIPevalExprActivity(scip, copyexpr) );
+
+   activity = SCIPexprGetActivity(expr);
+   copyactivity = SCIPexprGetActivity(copyexpr);
+   cr_expect_eq(activity.inf, copyactivity.inf);
+   cr_expect_eq(activity.sup, copyactivity.sup);
+   cr_expect(SCIPisRelEQ(scip, activity.inf, exp(0.5) + log(0.5) + 0.25 + 0.5), "inf = %g", activity.inf);
+
+   SCIP_CALL( SCIPreleaseExpr(scip, &copyexpr) );
+}
+
+Test(tape, invalidate, .description = "checks that the tape is recompiled when children of a subexpression change")
+{
+   SCIP_CALL( SCIPcompileExpr(scip, expr) );
+
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 1.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, y, 2.0) );
+
+   /* replace x in |x| by y */
+   SCIP_CALL( SCIPreplaceExprChild(scip, absexpr, 0, yexpr) );
+   cr_expect(expr->tape->structtag != scip->stat->exprlaststructtag);
+
+   SCIP_CALL( SCIPevalExpr(scip, expr, sol, 0L) );
+   cr_expect(expr->tape->structtag == scip->stat->exprlaststructtag);
+   cr_expect_eq(expr->tape->nops, 8);
+   cr_expect(SCIPisRelEQ(scip, SCIPexprGetEvalValue(expr), exp(2.0) + log(2.0) + 4.0 + 2.0));
+
+   /* append x to the sum */
+   SCIP_CALL( SCIPappendExprSumExpr(scip, expr, xexpr, 3.0) );
+   SCIP_CALL( SCIPevalExpr(scip, expr, sol, 0L) );
+   cr_expect(SCIPisRelEQ(scip, SCIPexprGetEvalValue(expr), exp(2.0) + log(2.0) + 4.0 + 2.0 + 3.0));
+}
@@ -0,0 +1,119 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   alns.c
+ * @brief  unit tests for solving several neighborhoods of the ALNS heuristic concurrently
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scipdefplugins.h"
+#include "scip/heur_alns.c"
+#include "tpi/tpi.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   SCIP_CALL( SCIPreadProb(scip, "../check/instances/MIP/flugpl.mps", NULL) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+/** checks that the neighborhoods for a parallel call are a permutation of the active neighborhoods */
+static
+void checkSelection(
+   char                  banditalgo          /**< the bandit algorithm to use */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_Bool selected[NNEIGHBORHOODS];
+   int neighborhoodidxs[NNEIGHBORHOODS];
+   int i;
+
+   SCIP_CALL( SCIPsetCharParam(scip, "heuristics/alns/banditalgo", banditalgo) );
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   heurdata = SCIPheurGetData(SCIPfindHeur(scip, "alns"));
+   cr_assert_not_null(heurdata);
+   cr_assert_gt(heurdata->nactiveneighborhoods, 1);
+
+   SCIP_CALL( selectNeighborhoods(scip, heurdata, neighborhoodidxs) );
+
+   BMSclearMemoryArray(selected, NNEIGHBORHOODS);
+   for( i = 0; i < heurdata->nactiveneighborhoods; ++i )
+   {
+      cr_assert(0 <= neighborhoodidxs[i] && neighborhoodidxs[i] < heurdata->nactiveneighborhoods);
+      cr_expect(!selected[neighborhoodidxs[i]], "neighborhood %d selected twice with bandit algorithm %c",
+         neighborhoodidxs[i], banditalgo);
+      selected[neighborhoodidxs[i]] = TRUE;
+   }
+}
+
+TestSuite(heuralns, .init = setup, .fini = teardown);
+
+Test(heuralns, selectucb, .description = "test that UCB selects distinct neighborhoods for a parallel call")
+{
+   checkSelection('u');
+}
+
+Test(heuralns, selectexp3, .description = "test that Exp.3 selects distinct neighborhoods for a parallel call")
+{
+   checkSelection('e');
+}
+
+Test(heuralns, selectepsgreedy, .description = "test that epsilon-greedy selects distinct neighborhoods for a parallel call")
+{
+   checkSelection('g');
+}
+
+Test(heuralns, parallel, .description = "test that solving with several concurrent ALNS neighborhoods stays correct")
+{
+   SCIP_HEUR* heur;
+
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/nparallel", 4) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/freq", 1) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "heuristics/alns/waitingnodes", 0LL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/alns/maxcallssamesol", -1) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   cr_expect(SCIPisEQ(scip, SCIPgetPrimalbound(scip), 1201500.0));
+
+   heur = SCIPfindHeur(scip, "alns");
+   cr_assert_not_null(heur);
+   cr_expect_gt(SCIPheurGetNCalls(heur), 0);
+}
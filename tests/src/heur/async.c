@@ -0,0 +1,135 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   async.c
+ * @brief  unit tests for the async primal heuristic
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scipdefplugins.h"
+#include "scip/heur_async.c"
+#include "tpi/tpi.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   SCIP_CALL( SCIPreadProb(scip, "../check/instances/MIP/flugpl.mps", NULL) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+TestSuite(heurasync, .init = setup, .fini = teardown);
+
+Test(heurasync, delegated, .description = "test that delegated heuristics are not executed at the nodes")
+{
+   const char* asyncheurs[] = { "rens", "rins", "crossover" };
+   int i;
+
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/async/freq", 1) );
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+
+   for( i = 0; i < 3; ++i )
+   {
+      SCIP_HEUR* heur;
+
+      heur = SCIPfindHeur(scip, asyncheurs[i]);
+      cr_assert_not_null(heur);
+      cr_expect(SCIPheurIsAsync(heur));
+
+      /* the heuristics are only delegated if jobs can run in the background */
+      if( SCIPtpiIsAvailable() && SCIPtpiCanStartJobs() )
+         cr_expect_eq(SCIPheurGetNCalls(heur), 0, "heuristic %s was called %lld times", asyncheurs[i],
+            SCIPheurGetNCalls(heur));
+
+      /* delegation ends with the solving process */
+      cr_expect(!SCIPheurIsDelegated(heur));
+   }
+}
+
+Test(heurasync, nodelegation, .description = "test that heuristics are not delegated if the async heuristic is not called regularly")
+{
+   SCIP_HEUR* heur;
+
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/async/freq", 0) );
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   heur = SCIPfindHeur(scip, "async");
+   cr_assert_not_null(heur);
+   cr_expect(!SCIPheurGetData(heur)->delegating);
+   cr_expect(!SCIPheurIsDelegated(SCIPfindHeur(scip, "rins")));
+}
+
+Test(heurasync, transfer, .description = "test that the solutions of a snapshot are transferred to the main problem")
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_HEUR* heur;
+   SCIP_RESULT result;
+   SCIP_SOL* bestsol;
+
+   if( !SCIPtpiIsAvailable() || !SCIPtpiCanStartJobs() )
+      return;
+
+   /* the main problem should not find solutions by itself */
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/async/freq", 1) );
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   heur = SCIPfindHeur(scip, "async");
+   cr_assert_not_null(heur);
+   heurdata = SCIPheurGetData(heur);
+   cr_assert(heurdata->delegating);
+   cr_expect(SCIPheurIsDelegated(SCIPfindHeur(scip, "rins")));
+   cr_assert_eq(SCIPgetNSols(scip), 0);
+
+   /* solve a snapshot and wait for the worker */
+   SCIP_CALL( startSnapshot(scip, heurdata) );
+   cr_assert_not_null(heurdata->jobbatch);
+
+   result = SCIP_DIDNOTFIND;
+   SCIP_CALL( finishSnapshot(scip, heur, heurdata, TRUE, &result) );
+   cr_expect_null(heurdata->jobbatch);
+   cr_expect_null(heurdata->subscip);
+
+   /* the copy is solved to optimality within the node limit, so its solutions improve the empty solution storage */
+   cr_expect_eq(result, SCIP_FOUNDSOL);
+   cr_assert_gt(SCIPgetNSols(scip), 0);
+
+   bestsol = SCIPgetBestSol(scip);
+   cr_expect_eq(SCIPsolGetHeur(bestsol), heur);
+}
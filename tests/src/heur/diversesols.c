@@ -0,0 +1,124 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   diversesols.c
+ * @brief  unit test for selecting diverse solutions with SCIPselectDiverseSols()
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/heuristics.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 6
+#define NSOLS 4
+
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+static SCIP_SOL* sols[NSOLS];
+
+/** values of the solutions; solution 1 differs from solution 0 in one variable, solution 3 in all variables */
+static const SCIP_Real solvals[NSOLS][NVARS] = {
+   { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 },
+   { 1.0, 1.0, 1.0, 0.0, 0.0, 1.0 },
+   { 0.0, 1.0, 1.0, 1.0, 0.0, 0.0 },
+   { 0.0, 0.0, 0.0, 1.0, 1.0, 1.0 }
+};
+
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "diversesols") );
+
+   for( j = 0; j < NVARS; ++j )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", j);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[j], name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[j]) );
+   }
+
+   for( i = 0; i < NSOLS; ++i )
+   {
+      SCIP_CALL( SCIPcreateOrigSol(scip, &sols[i], NULL) );
+      SCIP_CALL( SCIPsetSolVals(scip, sols[i], NVARS, vars, (SCIP_Real*) solvals[i]) );
+   }
+}
+
+static
+void teardown(void)
+{
+   int i;
+
+   for( i = 0; i < NSOLS; ++i )
+   {
+      SCIP_CALL( SCIPfreeSol(scip, &sols[i]) );
+   }
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+TestSuite(diversesols, .init = setup, .fini = teardown);
+
+Test(diversesols, select, .description = "test that the most diverse solutions are selected greedily")
+{
+   int selection[NSOLS];
+
+   SCIP_CALL( SCIPselectDiverseSols(scip, sols, NSOLS, 2, selection) );
+
+   /* the first solution is always selected, followed by the one that differs most from it */
+   cr_expect_eq(selection[0], 0);
+   cr_expect_eq(selection[1], 3);
+
+   SCIP_CALL( SCIPselectDiverseSols(scip, sols, NSOLS, 3, selection) );
+
+   /* solution 2 has distance 2 to solution 0 and distance 4 to solution 3, solution 1 has distance 1 to solution 0 */
+   cr_expect_eq(selection[2], 2);
+}
+
+Test(diversesols, ties, .description = "test that ties are broken in favor of earlier solutions")
+{
+   int selection[NSOLS];
+
+   /* let solutions 1 and 2 both have distance 2 to solution 0 */
+   SCIP_CALL( SCIPsetSolVal(scip, sols[1], vars[2], 0.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[1], vars[3], 1.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[1], vars[5], 0.0) );
+
+   SCIP_CALL( SCIPselectDiverseSols(scip, sols, NSOLS - 1, 2, selection) );
+
+   cr_expect_eq(selection[0], 0);
+   cr_expect_eq(selection[1], 1);
+}
@@ -275,7 +275,9 @@ Test(complex, test1)
    SCIP_Real binvcol[3];
    SCIP_Real coef[3];
    SCIP_Real coeftwo[3];
+   SCIP_Real binvrows[9];
    SCIP_Real objval;
+   int rowinds[] = {2, 0, 1};
    int cstats[3];
    int nrows;
    int rstats[3];
@@ -344,6 +346,18 @@ Test(complex, test1)
       }
    }
 
+   /* check that getting all rows of the basis inverse at once yields the same rows as getting them one by one */
+   SCIP_CALL( SCIPlpiGetBInvRows(lpi, nrows, rowinds, binvrows, NULL, NULL) );
+   for (entry = 0; entry < nrows; ++entry)
+   {
+      SCIP_CALL( SCIPlpiGetBInvRow(lpi, rowinds[entry], coef, NULL, NULL) );
+      for (idx = 0; idx < nrows; ++idx)
+      {
+         cr_expect_float_eq(binvrows[entry * nrows + idx], coef[idx], EPS, "BInvRows[%d][%d] = %g != %g\n", entry, idx,
+            binvrows[entry * nrows + idx], coef[idx]);
+      }
+   }
+
    /* check first column of basis inverse */
    SCIP_CALL( SCIPlpiGetBInvCol(lpi, 0, binvcol, NULL, NULL) );
 
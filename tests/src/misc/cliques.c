@@ -0,0 +1,241 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   cliques.c
+ * @brief  unit test for the clique lists and common clique queries of the clique table
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/struct_implics.h"
+#include "scip/struct_scip.h"
+#include "scip/struct_var.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 100
+
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+
+/* creates binary variables x0, ..., x99 in the presolving stage */
+static
+void createVars(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   SCIP_VAR* origvars[NVARS];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "cliques") );
+
+   /* the problem has no constraints, so the size of the clique table must not be limited by the number of nonzeros */
+   SCIP_CALL( SCIPsetRealParam(scip, "presolving/clqtablefac", SCIPinfinity(scip)) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &origvars[i], name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, origvars[i]) );
+   }
+
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_PRESOLVING, FALSE) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPgetTransformedVar(scip, origvars[i], &vars[i]) );
+      SCIP_CALL( SCIPreleaseVar(scip, &origvars[i]) );
+   }
+}
+
+/* creates the variables and the cliques x0 + xi <= 1 for i = 1, ..., 99 and x1 + ... + x99 <= 1 */
+static
+void setup(void)
+{
+   SCIP_Bool clqvals[NVARS];
+   SCIP_Bool infeasible;
+   int nbdchgs;
+   int i;
+
+   createVars();
+
+   for( i = 0; i < NVARS; ++i )
+      clqvals[i] = TRUE;
+
+   for( i = 1; i < NVARS; ++i )
+   {
+      SCIP_VAR* pair[2];
+
+      pair[0] = vars[0];
+      pair[1] = vars[i];
+      SCIP_CALL( SCIPaddClique(scip, pair, clqvals, 2, FALSE, &infeasible, &nbdchgs) );
+      cr_assert(!infeasible);
+   }
+
+   SCIP_CALL( SCIPaddClique(scip, &vars[1], clqvals, NVARS - 1, FALSE, &infeasible, &nbdchgs) );
+   cr_assert(!infeasible);
+}
+
+/* adds the clique xfirst + xsecond <= 1 */
+static
+void addPairClique(
+   int                   first,
+   int                   second
+   )
+{
+   SCIP_VAR* pair[2];
+   SCIP_Bool vals[2] = {TRUE, TRUE};
+   SCIP_Bool infeasible;
+   int nbdchgs;
+
+   pair[0] = vars[first];
+   pair[1] = vars[second];
+   SCIP_CALL( SCIPaddClique(scip, pair, vals, 2, FALSE, &infeasible, &nbdchgs) );
+   cr_assert(!infeasible);
+}
+
+/* updates the connected components of the clique graph if necessary by computing a clique partition */
+static
+void updateComponents(void)
+{
+   int cliquepartition[NVARS];
+   int ncliques;
+
+   SCIP_CALL( SCIPcalcCliquePartition(scip, vars, NVARS, cliquepartition, &ncliques) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+Test(cliques, commonclique, .init = setup, .fini = teardown,
+   .description = "checks common clique queries on clique lists of very different lengths"
+   )
+{
+   int i;
+
+   cr_assert_eq(SCIPvarGetNCliques(vars[0], TRUE), NVARS - 1);
+
+   for( i = 1; i < NVARS; ++i )
+   {
+      cr_expect_eq(SCIPvarGetNCliques(vars[i], TRUE), 2);
+      cr_expect(SCIPvarsHaveCommonClique(vars[0], TRUE, vars[i], TRUE, FALSE), "x0 and x%d should share a clique", i);
+      cr_expect(SCIPvarsHaveCommonClique(vars[i], TRUE, vars[0], TRUE, FALSE), "x%d and x0 should share a clique", i);
+      cr_expect(!SCIPvarsHaveCommonClique(vars[0], FALSE, vars[i], TRUE, FALSE));
+      cr_expect(!SCIPvarsHaveCommonClique(vars[0], TRUE, vars[i], FALSE, FALSE));
+   }
+
+   cr_expect(SCIPvarsHaveCommonClique(vars[1], TRUE, vars[NVARS - 1], TRUE, FALSE));
+}
+
+Test(cliques, compaction, .init = setup, .fini = teardown,
+   .description = "checks that the clique table cleanup compacts the clique and clique list arrays"
+   )
+{
+   SCIP_CLIQUE** cliques;
+   SCIP_Bool infeasible;
+   SCIP_Bool fixed;
+   int i;
+
+   /* fix all but the last ten variables to zero */
+   for( i = 1; i < NVARS - 10; ++i )
+   {
+      SCIP_CALL( SCIPfixVar(scip, vars[i], 0.0, &infeasible, &fixed) );
+      cr_assert(!infeasible);
+      cr_assert(fixed);
+   }
+
+   SCIP_CALL( SCIPcleanupCliques(scip, &infeasible) );
+   cr_assert(!infeasible);
+
+   /* only the cliques with the unfixed variables remain in the list of x0, which got compacted */
+   cr_expect_eq(SCIPvarGetNCliques(vars[0], TRUE), 10);
+   cr_expect(vars[0]->cliquelist->size[1] < 40, "clique list of x0 was not compacted, size %d",
+      vars[0]->cliquelist->size[1]);
+
+   for( i = NVARS - 10; i < NVARS; ++i )
+   {
+      cr_expect(SCIPvarsHaveCommonClique(vars[0], TRUE, vars[i], TRUE, FALSE), "x0 and x%d should share a clique", i);
+      cr_expect(SCIPvarsHaveCommonClique(vars[NVARS - 10], TRUE, vars[i], TRUE, FALSE) || i == NVARS - 10);
+   }
+
+   /* the large clique only contains the unfixed variables and its arrays were shrunk */
+   cliques = SCIPvarGetCliques(vars[NVARS - 1], TRUE);
+   for( i = 0; i < SCIPvarGetNCliques(vars[NVARS - 1], TRUE); ++i )
+   {
+      if( SCIPcliqueGetNVars(cliques[i]) > 2 )
+      {
+         cr_expect_eq(SCIPcliqueGetNVars(cliques[i]), 10);
+         cr_expect_eq(cliques[i]->size, 10, "size %d", cliques[i]->size);
+      }
+   }
+}
+
+Test(cliques, components, .init = createVars, .fini = teardown,
+   .description = "checks that the connected components of the clique graph are updated incrementally"
+   )
+{
+   SCIP_CLIQUETABLE* cliquetable = scip->cliquetable;
+   SCIP_Bool infeasible;
+   SCIP_Bool fixed;
+
+   addPairClique(1, 2);
+   updateComponents();
+   cr_assert(cliquetable->djset != NULL);
+   cr_assert(!cliquetable->compsfromscratch);
+   cr_expect_eq(cliquetable->ncliquecomponents, NVARS - 1);
+
+   /* added cliques merge components without a recomputation */
+   addPairClique(3, 4);
+   addPairClique(4, 5);
+   cr_assert(!cliquetable->compsfromscratch);
+   cr_expect_eq(cliquetable->ncliquecomponents, NVARS - 3);
+
+   /* removing a single clique keeps the coarser components */
+   SCIP_CALL( SCIPfixVar(scip, vars[1], 0.0, &infeasible, &fixed) );
+   cr_assert(fixed);
+   SCIP_CALL( SCIPcleanupCliques(scip, &infeasible) );
+   cr_assert(!infeasible);
+   cr_expect_eq(cliquetable->ncompdelentries, 2);
+   cr_expect_eq(cliquetable->nentries, 4);
+   updateComponents();
+   cr_expect_eq(cliquetable->ncompdelentries, 2, "components should not have been recomputed");
+
+   /* after removing more than half of the entries, the components are recomputed lazily */
+   SCIP_CALL( SCIPfixVar(scip, vars[3], 0.0, &infeasible, &fixed) );
+   cr_assert(fixed);
+   SCIP_CALL( SCIPcleanupCliques(scip, &infeasible) );
+   cr_assert(!infeasible);
+   cr_expect_eq(cliquetable->ncompdelentries, 4);
+   cr_expect_eq(cliquetable->nentries, 2);
+
+   updateComponents();
+   cr_expect_eq(cliquetable->ncompdelentries, 0, "components should have been recomputed");
+   cr_expect_eq(cliquetable->ncliquecomponents, NVARS - 3);
+}
@@ -0,0 +1,187 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   conflictstore.c
+ * @brief  unit test for the subsumption checks of the conflict store
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/struct_conflictstore.h"
+#include "scip/struct_scip.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 5
+
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+static SCIP_VAR* intvar;
+
+/* creates binary variables x0, ..., x4 and an integer variable y in [0,10] in the solving stage */
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   SCIP_VAR* origvars[NVARS];
+   SCIP_VAR* origintvar;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "conflictstore") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &origvars[i], name, 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, origvars[i]) );
+   }
+   SCIP_CALL( SCIPcreateVarBasic(scip, &origintvar, "y", 0.0, 10.0, 1.0, SCIP_VARTYPE_INTEGER) );
+   SCIP_CALL( SCIPaddVar(scip, origintvar) );
+
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPgetTransformedVar(scip, origvars[i], &vars[i]) );
+      SCIP_CALL( SCIPreleaseVar(scip, &origvars[i]) );
+   }
+   SCIP_CALL( SCIPgetTransformedVar(scip, origintvar, &intvar) );
+   SCIP_CALL( SCIPreleaseVar(scip, &origintvar) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/* adds the global conflict x[inds[0]] + ... + x[inds[n-1]] >= 1 */
+static
+void addLogicorConflict(
+   int*                  inds,
+   int                   n
+   )
+{
+   SCIP_VAR* consvars[NVARS];
+   SCIP_CONS* cons;
+   int i;
+
+   for( i = 0; i < n; ++i )
+      consvars[i] = vars[inds[i]];
+
+   SCIP_CALL( SCIPcreateConsLogicor(scip, &cons, "conf", n, consvars, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE,
+         FALSE, FALSE, TRUE) );
+   SCIP_CALL( SCIPaddConflict(scip, NULL, cons, NULL, SCIP_CONFTYPE_PROPAGATION, FALSE) );
+}
+
+/* adds the global conflict (y >= ybound) or (x0 >= 1) or ... or (x[nbinvars-1] >= 1) */
+static
+void addBounddisjunctionConflict(
+   SCIP_Real             ybound,
+   int                   nbinvars
+   )
+{
+   SCIP_BOUNDTYPE boundtypes[NVARS + 1];
+   SCIP_VAR* consvars[NVARS + 1];
+   SCIP_Real bounds[NVARS + 1];
+   SCIP_CONS* cons;
+   int i;
+
+   consvars[0] = intvar;
+   boundtypes[0] = SCIP_BOUNDTYPE_LOWER;
+   bounds[0] = ybound;
+
+   for( i = 0; i < nbinvars; ++i )
+   {
+      consvars[i + 1] = vars[i];
+      boundtypes[i + 1] = SCIP_BOUNDTYPE_LOWER;
+      bounds[i + 1] = 1.0;
+   }
+
+   SCIP_CALL( SCIPcreateConsBounddisjunction(scip, &cons, "conf", nbinvars + 1, consvars, boundtypes, bounds, FALSE,
+         TRUE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE, TRUE) );
+   SCIP_CALL( SCIPaddConflict(scip, NULL, cons, NULL, SCIP_CONFTYPE_PROPAGATION, FALSE) );
+}
+
+Test(conflictstore, logicor, .init = setup, .fini = teardown,
+   .description = "checks that subsumed logicor conflicts are removed from the conflict store"
+   )
+{
+   int conf1[] = {0, 1, 2};
+   int conf2[] = {0, 1};
+   int conf3[] = {1, 3};
+   int conf4[] = {3, 1, 0};
+
+   addLogicorConflict(conf1, 3);
+   cr_expect_eq(scip->conflictstore->nconflicts, 1);
+
+   /* x0 + x1 >= 1 implies x0 + x1 + x2 >= 1, which is removed */
+   addLogicorConflict(conf2, 2);
+   cr_expect_eq(scip->conflictstore->nconflicts, 1);
+   cr_expect_eq(scip->conflictstore->nsubsumed, 1);
+   cr_expect(SCIPgetNVarsLogicor(scip, scip->conflictstore->conflicts[0]) == 2);
+
+   /* x1 + x3 >= 1 neither implies nor is implied by x0 + x1 >= 1 */
+   addLogicorConflict(conf3, 2);
+   cr_expect_eq(scip->conflictstore->nconflicts, 2);
+   cr_expect_eq(scip->conflictstore->nsubsumed, 1);
+
+   /* x0 + x1 + x3 >= 1 is implied by a stored conflict and is not added */
+   addLogicorConflict(conf4, 3);
+   cr_expect_eq(scip->conflictstore->nconflicts, 2);
+   cr_expect_eq(scip->conflictstore->nsubsumed, 2);
+}
+
+Test(conflictstore, bounddisjunction, .init = setup, .fini = teardown,
+   .description = "checks that implied literals are detected in the subsumption checks of bounddisjunction conflicts"
+   )
+{
+   /* (y >= 3) or (x0 >= 1) or (x1 >= 1) */
+   addBounddisjunctionConflict(3.0, 2);
+   cr_expect_eq(scip->conflictstore->nconflicts, 1);
+
+   /* (y >= 5) or (x0 >= 1) implies the first conflict, since y >= 5 implies y >= 3 */
+   addBounddisjunctionConflict(5.0, 1);
+   cr_expect_eq(scip->conflictstore->nconflicts, 1);
+   cr_expect_eq(scip->conflictstore->nsubsumed, 1);
+   cr_expect(SCIPisEQ(scip, SCIPgetBoundsBounddisjunction(scip, scip->conflictstore->conflicts[0])[0], 5.0));
+
+   /* (y >= 2) or (x0 >= 1) is implied by the stored conflict and is not added */
+   addBounddisjunctionConflict(2.0, 1);
+   cr_expect_eq(scip->conflictstore->nconflicts, 1);
+   cr_expect_eq(scip->conflictstore->nsubsumed, 2);
+   cr_expect(SCIPisEQ(scip, SCIPgetBoundsBounddisjunction(scip, scip->conflictstore->conflicts[0])[0], 5.0));
+
+   /* y >= 6 implies the stored conflict, which is replaced */
+   addBounddisjunctionConflict(6.0, 0);
+   cr_expect_eq(scip->conflictstore->nconflicts, 1);
+   cr_expect_eq(scip->conflictstore->nsubsumed, 3);
+   cr_expect_eq(SCIPgetNVarsBounddisjunction(scip, scip->conflictstore->conflicts[0]), 1);
+}
@@ -314,3 +314,55 @@ Test(projection, fourrows, .init = setup, .fini=teardown,
 
    SCIP_CALL( SCIPendProbing(scip) );
 }
+
+Test(parallel, findnewbounds, .init = setup, .fini=teardown,
+   .description = "solves the OBBT LPs of several bounds on copies of the probing LP"
+   )
+{
+   SCIP_PROPDATA propdata;
+   BOUND boundsdata[4];
+   BOUND* bounds[4];
+   SCIP_Longint nleftiterations;
+   SCIP_Bool infeasible;
+   int i;
+
+   /* construct LP */
+   SCIP_CALL( SCIPconstructLP(scip, &infeasible) );
+   assert(!infeasible);
+
+   SCIP_CALL( SCIPstartProbing(scip) );
+
+   /* x + y <= 2 and x - y <= 1 imply x <= 1.5 */
+   SCIP_CALL( addRowProbing(scip, x, y, 1.0, 1.0, -SCIPinfinity(scip), 2.0) );
+   SCIP_CALL( addRowProbing(scip, x, y, 1.0, -1.0, -SCIPinfinity(scip), 1.0) );
+
+   BMSclearMemory(&propdata);
+   BMSclearMemoryArray(boundsdata, 4);
+   for( i = 0; i < 4; ++i )
+   {
+      boundsdata[i].var = i < 2 ? x : y;
+      boundsdata[i].boundtype = i % 2 == 0 ? SCIP_BOUNDTYPE_LOWER : SCIP_BOUNDTYPE_UPPER;
+      boundsdata[i].nonconvex = TRUE;
+      boundsdata[i].index = i;
+      bounds[i] = &boundsdata[i];
+   }
+   propdata.bounds = bounds;
+   propdata.nbounds = 4;
+   propdata.nthreads = 2;
+
+   nleftiterations = -1;
+   SCIP_CALL( findNewBoundsParallel(scip, &propdata, &nleftiterations) );
+
+   cr_expect_eq(propdata.nsolvedbounds, 4);
+   for( i = 0; i < 4; ++i )
+   {
+      cr_expect(bounds[i]->done);
+      cr_expect(bounds[i]->found);
+   }
+   cr_expect(SCIPisEQ(scip, bounds[0]->newval, -10.0));
+   cr_expect(SCIPisEQ(scip, bounds[1]->newval, 1.5));
+   cr_expect(SCIPisEQ(scip, bounds[2]->newval, -5.0));
+   cr_expect(SCIPisEQ(scip, bounds[3]->newval, 5.0));
+
+   SCIP_CALL( SCIPendProbing(scip) );
+}
@@ -0,0 +1,220 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   probing.c
+ * @brief  unit test for the parallel probing jobs of prop_probing
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/cons_linear.h"
+#include "scip/prop_probing.c"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+static SCIP_VAR* vars[4];
+
+/* creates the problem min x + y + z - w s.t. x + y + z = 1, w - 10 x <= 0, with binary x, y, z and w in [wlb,10] */
+static
+void createProblem(
+   SCIP_Real             wlb
+   )
+{
+   SCIP_CONS* cons;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeConshdlrLinear(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "probing") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[0], "x", 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[1], "y", 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[2], "z", 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[3], "w", wlb, 10.0, -1.0, SCIP_VARTYPE_CONTINUOUS) );
+   for( i = 0; i < 4; ++i )
+   {
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "partition", 0, NULL, NULL, 1.0, 1.0) );
+   for( i = 0; i < 3; ++i )
+   {
+      SCIP_CALL( SCIPaddCoefLinear(scip, cons, vars[i], 1.0) );
+   }
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "vub", 0, NULL, NULL, -SCIPinfinity(scip), 0.0) );
+   SCIP_CALL( SCIPaddCoefLinear(scip, cons, vars[3], 1.0) );
+   SCIP_CALL( SCIPaddCoefLinear(scip, cons, vars[0], -10.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   /* the constraints are activated in the transformed problem, but not propagated */
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_TRANSFORMED, FALSE) );
+}
+
+static
+void setup(void)
+{
+   createProblem(0.0);
+}
+
+static
+void setupInfeasible(void)
+{
+   createProblem(5.0);
+}
+
+static
+void teardown(void)
+{
+   int i;
+
+   for( i = 3; i >= 0; --i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** probes x to zero and one in a single job and gets the results in the format of SCIPapplyProbingVar() */
+static
+void probeX(
+   SCIP_VAR**            transvars,          /**< transformed variables */
+   SCIP_Bool*            zerocutoff,         /**< pointer to store whether x = 0 is infeasible */
+   SCIP_Real*            zerolbs,            /**< array to store the propagated lower bounds for x = 0 */
+   SCIP_Real*            zeroubs,            /**< array to store the propagated upper bounds for x = 0 */
+   SCIP_Bool*            onecutoff,          /**< pointer to store whether x = 1 is infeasible */
+   SCIP_Real*            onelbs,             /**< array to store the propagated lower bounds for x = 1 */
+   SCIP_Real*            oneubs              /**< array to store the propagated upper bounds for x = 1 */
+   )
+{
+   PROBINGCOPY* copy;
+   PROBINGJOB job;
+   PROBINGBATCH batch;
+   SCIP_Real impllbs[4];
+   SCIP_Real implubs[4];
+   SCIP_Bool cutoff[2];
+   int implbeg[3];
+   int propbeg[2];
+   int cands[1];
+   int candjob[1];
+   int candidx[1];
+   int i;
+
+   for( i = 0; i < 4; ++i )
+   {
+      SCIP_CALL( SCIPgetTransformedVar(scip, vars[i], &transvars[i]) );
+      cr_assert(SCIPvarIsActive(transvars[i]));
+   }
+
+   SCIP_CALL( createProbingCopy(scip, transvars, 4, -1, &copy) );
+   cr_expect_eq(copy->nrows, 2, "expected 2 rows in the copy, got %d", copy->nrows);
+
+   BMSclearMemory(&job);
+   cands[0] = 0;
+   job.copy = copy;
+   job.cands = cands;
+   job.ncands = 1;
+   job.cutoff = cutoff;
+   job.implbeg = implbeg;
+   job.propbeg = propbeg;
+   SCIP_CALL( probingJob((void*) &job) );
+
+   candjob[0] = 0;
+   candidx[0] = 0;
+   batch.jobs = &job;
+   batch.candjob = candjob;
+   batch.candidx = candidx;
+   batch.njobs = 1;
+   batch.startidx = 0;
+   batch.endidx = 1;
+
+   cr_assert(getParallelProbingResult(scip, &batch, transvars, 4, 0, FALSE, impllbs, implubs, zerolbs, zeroubs,
+         zerocutoff));
+   cr_assert(getParallelProbingResult(scip, &batch, transvars, 4, 0, TRUE, impllbs, implubs, onelbs, oneubs,
+         onecutoff));
+   cr_assert(!getParallelProbingResult(scip, &batch, transvars, 4, 1, TRUE, impllbs, implubs, onelbs, oneubs,
+         onecutoff));
+
+   BMSfreeMemoryArrayNull(&job.resubs);
+   BMSfreeMemoryArrayNull(&job.reslbs);
+   BMSfreeMemoryArrayNull(&job.respos);
+   freeProbingCopy(scip, &copy);
+}
+
+Test(parallelprobing, deductions, .init = setup, .fini = teardown,
+   .description = "checks the bounds deduced by a parallel probing job on the copy of the linear constraints"
+   )
+{
+   SCIP_VAR* transvars[4];
+   SCIP_Real zerolbs[4];
+   SCIP_Real zeroubs[4];
+   SCIP_Real onelbs[4];
+   SCIP_Real oneubs[4];
+   SCIP_Bool zerocutoff;
+   SCIP_Bool onecutoff;
+
+   probeX(transvars, &zerocutoff, zerolbs, zeroubs, &onecutoff, onelbs, oneubs);
+
+   cr_assert(!zerocutoff);
+   cr_assert(!onecutoff);
+
+   /* x = 0: w <= 0, y and z are free */
+   cr_expect_eq(zeroubs[0], 0.0);
+   cr_expect_eq(zeroubs[3], 0.0, "expected w <= 0, got %g", zeroubs[3]);
+   cr_expect_eq(zeroubs[1], 1.0);
+   cr_expect_eq(zeroubs[2], 1.0);
+
+   /* x = 1: y = z = 0, w is free */
+   cr_expect_eq(onelbs[0], 1.0);
+   cr_expect_eq(oneubs[1], 0.0, "expected y <= 0, got %g", oneubs[1]);
+   cr_expect_eq(oneubs[2], 0.0, "expected z <= 0, got %g", oneubs[2]);
+   cr_expect_eq(oneubs[3], 10.0);
+}
+
+Test(parallelprobing, infeasible, .init = setupInfeasible, .fini = teardown,
+   .description = "checks that a parallel probing job detects an infeasible fixing"
+   )
+{
+   SCIP_VAR* transvars[4];
+   SCIP_Real zerolbs[4];
+   SCIP_Real zeroubs[4];
+   SCIP_Real onelbs[4];
+   SCIP_Real oneubs[4];
+   SCIP_Bool zerocutoff;
+   SCIP_Bool onecutoff;
+
+   probeX(transvars, &zerocutoff, zerolbs, zeroubs, &onecutoff, onelbs, oneubs);
+
+   /* x = 0 contradicts w >= 5 */
+   cr_assert(zerocutoff);
+   cr_assert(!onecutoff);
+   cr_expect_eq(onelbs[3], 5.0);
+}
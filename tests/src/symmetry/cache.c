@@ -0,0 +1,219 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   cache.c
+ * @brief  unit tests for the on-disk cache of symmetry generators
+ */
+
+#include <scip/scip.h>
+#include <include/scip_test.h>
+#include <scip/prop_symmetry.c>
+#include <symmetry/compute_symmetry.h>
+#include <scip/scipdefplugins.h>
+
+/* global SCIP instance */
+static SCIP* scip;
+
+/** setup: create SCIP */
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   /* turn on symmetry computation and the symmetry cache in the working directory */
+   SCIP_CALL( SCIPsetIntParam(scip, "misc/usesymmetry", 1) );
+   SCIP_CALL( SCIPsetStringParam(scip, "propagating/symmetry/cachedir", ".") );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/symmetry/checksymmetries", TRUE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "propagating/symmetry/detectsubgroups", FALSE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrounds", 0) );
+}
+
+/** teardown: free SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!");
+}
+
+/** creates and presolves the problem min c (x1 + x2 + x3 + x4) s.t. x1 + x2 = 1, x3 + x4 = 1, x binary */
+static
+void createProblem(
+   SCIP_Real             obj                 /**< objective coefficient c of all variables */
+   )
+{
+   SCIP_VAR* vars[4];
+   SCIP_CONS* cons;
+   SCIP_Real vals[2] = {1.0, 1.0};
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "cache") );
+
+   for (i = 0; i < 4; ++i)
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i + 1);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, obj, SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "e1", 2, &vars[0], vals, 1.0, 1.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "e2", 2, &vars[2], vals, 1.0, 1.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for (i = 0; i < 4; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   /* presolve problem (symmetry will be available afterwards) */
+   SCIP_CALL( SCIPpresolve(scip) );
+}
+
+/** creates the colored symmetry detection graph of the presolved problem as done in computeSymmetryGroup() */
+static
+void createGraph(
+   SYM_GRAPH**           graph               /**< pointer to store the graph */
+   )
+{
+   SCIP_CONS** conss;
+   SCIP_Bool success;
+   int nopnodes;
+   int nvalnodes;
+   int nconsnodes;
+   int nedges;
+   int c;
+
+   SCIP_CALL( estimateSymgraphSize(scip, &nopnodes, &nvalnodes, &nconsnodes, &nedges) );
+   SCIP_CALL( SCIPcreateSymgraph(scip, SYM_SYMTYPE_PERM, graph, SCIPgetVars(scip), SCIPgetNVars(scip),
+         nopnodes, nvalnodes, nconsnodes, nedges) );
+
+   conss = SCIPgetConss(scip);
+   for (c = 0; c < SCIPgetNConss(scip); ++c)
+   {
+      SCIP_CALL( SCIPgetConsPermsymGraph(scip, conss[c], *graph, &success) );
+      cr_assert( success );
+   }
+
+   SCIP_CALL( SCIPcomputeSymgraphColors(scip, *graph, (SYM_SPEC) 0) );
+}
+
+/** returns the symmetry propagator data */
+static
+SCIP_PROPDATA* getPropdata(void)
+{
+   SCIP_PROP* prop;
+
+   prop = SCIPfindProp(scip, PROP_NAME);
+   cr_assert( prop != NULL );
+
+   return SCIPpropGetData(prop);
+}
+
+Test(symmetry_cache, readwrite, .init = setup, .fini = teardown,
+   .description = "checks that generators stored in the symmetry cache are reused for graphs with the same colors")
+{
+   char filename[SCIP_MAXSTRLEN];
+   SYM_GRAPH* graph;
+   SCIP_PROPDATA* propdata;
+   FILE* file;
+   uint64_t hash;
+   int** perms;
+   SCIP_Real log10groupsize;
+   SCIP_Bool success;
+   int nmaxperms;
+   int nperms;
+   int p;
+
+   /* skip test if no symmetry can be computed */
+   if ( ! SYMcanComputeSymmetry() )
+      return;
+
+   /* the first solve computes the generators and stores them in the cache */
+   createProblem(1.0);
+   propdata = getPropdata();
+   cr_assert( propdata->nperms == 3 );
+
+   createGraph(&graph);
+   hash = SCIPgetSymgraphHash(graph, SYMCACHE_FILESEED);
+   cr_expect( hash != SCIPgetSymgraphHash(graph, SYMCACHE_CHECKSEED) );
+   getSymmetryCacheFilename(graph, ".", filename);
+
+   file = fopen(filename, "r");
+   cr_assert( file != NULL, "symmetry cache file <%s> was not written", filename );
+   (void) fclose(file);
+
+   SCIP_CALL( readSymmetryCache(scip, graph, ".", propdata->maxgenerators, &perms, &nperms, &nmaxperms,
+         &log10groupsize, &success) );
+   cr_assert( success );
+   cr_assert( nperms == 3 );
+   cr_expect( EPSEQ(log10groupsize, propdata->log10groupsize, 1e-9) );
+
+   /* a different limit on the number of generators does not match the cache entry */
+   SCIP_CALL( readSymmetryCache(scip, graph, ".", propdata->maxgenerators + 1, &perms, &nperms, &nmaxperms,
+         &log10groupsize, &success) );
+   cr_expect( ! success );
+
+   /* mark the cache entry by a different group size to detect that it is used */
+   SCIP_CALL( writeSymmetryCache(scip, graph, ".", propdata->maxgenerators, perms, nperms, 42.0) );
+
+   for (p = 0; p < nperms; ++p)
+   {
+      SCIPfreeBlockMemoryArray(scip, &perms[p], SCIPgetNVars(scip));
+   }
+   SCIPfreeBlockMemoryArray(scip, &perms, nmaxperms);
+   SCIP_CALL( SCIPfreeSymgraph(scip, &graph) );
+
+   /* a different objective leads to the same colors, so the cached generators are used */
+   SCIP_CALL( SCIPfreeProb(scip) );
+   createProblem(2.0);
+   propdata = getPropdata();
+   cr_expect( propdata->nperms == 3 );
+   cr_expect( EPSEQ(propdata->log10groupsize, 42.0, 1e-9), "cached group size not used: %g", propdata->log10groupsize );
+
+   /* a truncated cache file is ignored */
+   createGraph(&graph);
+   cr_expect( SCIPgetSymgraphHash(graph, SYMCACHE_FILESEED) == hash );
+
+   file = fopen(filename, "w");
+   cr_assert( file != NULL );
+   (void) fprintf(file, "%s\n", SYMCACHE_HEADER);
+   (void) fprintf(file, "%016llx 0 4 %d %d %d\n", (unsigned long long) SCIPgetSymgraphHash(graph, SYMCACHE_CHECKSEED),
+      SCIPgetSymgraphNNodes(graph), SCIPgetSymgraphNEdges(graph), propdata->maxgenerators);
+   (void) fprintf(file, "3 1.0\n1 0 2 3\n1 1 2 3\n");
+   (void) fclose(file);
+
+   SCIP_CALL( readSymmetryCache(scip, graph, ".", propdata->maxgenerators, &perms, &nperms, &nmaxperms,
+         &log10groupsize, &success) );
+   cr_expect( ! success );
+   cr_expect( log10groupsize == 0.0 );
+
+   SCIP_CALL( SCIPfreeSymgraph(scip, &graph) );
+   (void) remove(filename);
+}
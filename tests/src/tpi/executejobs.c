@@ -0,0 +1,157 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   executejobs.c
+ * @brief  unittest for executing jobs on separate threads with SCIPtpiExecuteJobs()
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "tpi/tpi.h"
+
+#include "include/scip_test.h"
+
+#define NJOBS 50
+
+/** argument of a test job */
+struct JobArg
+{
+   int                   input;              /**< input of the job */
+   int                   output;             /**< output of the job */
+   int                   ncalls;             /**< number of times the job has been executed */
+   SCIP_Bool             fail;               /**< should the job fail? */
+};
+typedef struct JobArg JOBARG;
+
+static JOBARG jobs[NJOBS];
+static void* jobargs[NJOBS];
+
+/** squares the input of the job */
+static
+SCIP_RETCODE squareJob(
+   void*                 args                /**< the job argument */
+   )
+{
+   JOBARG* job = (JOBARG*) args;
+
+   job->output = job->input * job->input;
+   ++job->ncalls;
+
+   return job->fail ? SCIP_INVALIDDATA : SCIP_OKAY;
+}
+
+static
+void setup(void)
+{
+   int i;
+
+   for( i = 0; i < NJOBS; ++i )
+   {
+      jobs[i].input = i;
+      jobs[i].output = -1;
+      jobs[i].ncalls = 0;
+      jobs[i].fail = FALSE;
+      jobargs[i] = (void*) &jobs[i];
+   }
+}
+
+TestSuite(executejobs, .init = setup);
+
+Test(executejobs, sequential, .description = "test that all jobs are executed by the calling thread")
+{
+   int i;
+
+   cr_assert_eq(SCIPtpiExecuteJobs(squareJob, jobargs, NJOBS, 1), SCIP_OKAY);
+
+   for( i = 0; i < NJOBS; ++i )
+      cr_expect_eq(jobs[i].output, i * i);
+}
+
+Test(executejobs, parallel, .description = "test that all jobs are executed exactly once on several threads")
+{
+   int i;
+
+   cr_assert_eq(SCIPtpiExecuteJobs(squareJob, jobargs, NJOBS, 4), SCIP_OKAY);
+
+   for( i = 0; i < NJOBS; ++i )
+   {
+      cr_expect_eq(jobs[i].output, i * i);
+      cr_expect_eq(jobs[i].ncalls, 1, "job %d was executed %d times", i, jobs[i].ncalls);
+   }
+}
+
+Test(executejobs, failure, .description = "test that the smallest return code of all jobs is returned")
+{
+   int i;
+
+   jobs[7].fail = TRUE;
+
+   cr_expect_eq(SCIPtpiExecuteJobs(squareJob, jobargs, NJOBS, 4), SCIP_INVALIDDATA);
+
+   /* the other jobs are still executed */
+   for( i = 0; i < NJOBS; ++i )
+      cr_expect_eq(jobs[i].output, i * i);
+}
+
+Test(executejobs, async, .description = "test that started jobs are finished after waiting for them")
+{
+   SCIP_JOBBATCH* jobbatch;
+   int i;
+
+   jobs[3].fail = TRUE;
+
+   cr_assert_eq(SCIPtpiStartJobs(squareJob, jobargs, NJOBS, 2, &jobbatch), SCIP_OKAY);
+   cr_assert_not_null(jobbatch);
+
+   cr_expect_eq(SCIPtpiWaitJobs(&jobbatch), SCIP_INVALIDDATA);
+   cr_expect_null(jobbatch);
+
+   for( i = 0; i < NJOBS; ++i )
+      cr_expect_eq(jobs[i].output, i * i);
+}
+
+Test(executejobs, finished, .description = "test that started jobs are reported as finished once they are done")
+{
+   SCIP_JOBBATCH* jobbatch;
+   int i;
+
+   cr_assert_eq(SCIPtpiStartJobs(squareJob, jobargs, NJOBS, 2, &jobbatch), SCIP_OKAY);
+   cr_assert_not_null(jobbatch);
+
+   /* if the jobs cannot run in the background, they are already done */
+   if( !SCIPtpiCanStartJobs() )
+      cr_expect(SCIPtpiJobsFinished(jobbatch));
+
+   while( !SCIPtpiJobsFinished(jobbatch) )
+   {
+   }
+
+   /* the results are available as soon as the batch is reported as finished */
+   for( i = 0; i < NJOBS; ++i )
+      cr_expect_eq(jobs[i].output, i * i);
+
+   cr_expect_eq(SCIPtpiWaitJobs(&jobbatch), SCIP_OKAY);
+   cr_expect_null(jobbatch);
+}